@@ -28,6 +28,7 @@ public class GeneralUtility : ModuleRules
 			new string[]
 			{
 				"Core",
+				"AIModule",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -43,6 +44,11 @@ public class GeneralUtility : ModuleRules
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
+
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("UnrealEd");
+		}
 		
 		
 		DynamicallyLoadedModuleNames.AddRange(
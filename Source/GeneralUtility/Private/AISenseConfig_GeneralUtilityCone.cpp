@@ -0,0 +1,22 @@
+#include "AISenseConfig_GeneralUtilityCone.h"
+
+UAISenseConfig_GeneralUtilityCone::UAISenseConfig_GeneralUtilityCone(const FObjectInitializer &ObjectInitializer)
+        : Super(ObjectInitializer) {
+    DebugColor = FColor::Cyan;
+
+    Distance = 3000.f;
+    HorizontalFieldOfView = 90.f;
+    VerticalFieldOfView = 60.f;
+    ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Pawn));
+    bTraceComplex = false;
+    bTestLineOfSight = true;
+    LineOfSightChannel = ECC_Visibility;
+
+    DetectionByAffiliation.bDetectEnemies = true;
+
+    Implementation = UAISense_GeneralUtilityCone::StaticClass();
+}
+
+TSubclassOf<UAISense> UAISenseConfig_GeneralUtilityCone::GetSenseImplementation() const {
+    return *Implementation;
+}
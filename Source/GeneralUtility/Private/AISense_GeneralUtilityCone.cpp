@@ -0,0 +1,117 @@
+#include "AISense_GeneralUtilityCone.h"
+#include <AISystem.h>
+#include <Perception/AIPerceptionComponent.h>
+#include <WorldCollision.h>
+#include "AISenseConfig_GeneralUtilityCone.h"
+#include "GeneralUtilityBPLibrary.h"
+
+DECLARE_CYCLE_STAT(TEXT("Perception Sense: General Utility Cone"), STAT_AI_Sense_GeneralUtilityCone, STATGROUP_AI);
+
+UAISense_GeneralUtilityCone::UAISense_GeneralUtilityCone(const FObjectInitializer &ObjectInitializer)
+        : Super(ObjectInitializer), MaxQueriesPerUpdate(6), NextQueryIndex(0) {
+    if (!HasAnyFlags(RF_ClassDefaultObject)) {
+        OnNewListenerDelegate.BindUObject(this, &UAISense_GeneralUtilityCone::OnNewListenerImpl);
+        OnListenerUpdateDelegate.BindUObject(this, &UAISense_GeneralUtilityCone::OnListenerUpdateImpl);
+        OnListenerRemovedDelegate.BindUObject(this, &UAISense_GeneralUtilityCone::OnListenerRemovedImpl);
+    }
+
+    NotifyType = EAISenseNotifyType::OnPerceptionChange;
+    bAutoRegisterAllPawnsAsSources = false;
+    DefaultExpirationAge = FLT_MAX;
+}
+
+float UAISense_GeneralUtilityCone::Update() {
+    SCOPE_CYCLE_COUNTER(STAT_AI_Sense_GeneralUtilityCone);
+
+    AIPerception::FListenerMap &listenersMap = *GetListeners();
+    int32 queries = FMath::Min(FMath::Max(MaxQueriesPerUpdate, 1), QueryQueue.Num());
+
+    for (int32 i = 0; i < queries; i++) {
+        NextQueryIndex = NextQueryIndex % QueryQueue.Num();
+        FPerceptionListener *listener = listenersMap.Find(QueryQueue[NextQueryIndex++]);
+
+        if (listener == nullptr || !listener->HasSense(GetSenseID())) {
+            continue;
+        }
+
+        const UAIPerceptionComponent *component = listener->Listener.Get();
+        const UAISenseConfig_GeneralUtilityCone *senseConfig = component != nullptr
+                ? Cast<const UAISenseConfig_GeneralUtilityCone>(component->GetSenseConfig(GetSenseID()))
+                : nullptr;
+
+        if (senseConfig != nullptr) {
+            QueryListener(*listener, *senseConfig);
+        }
+    }
+
+    return 0.f;
+}
+
+void UAISense_GeneralUtilityCone::QueryListener(FPerceptionListener &Listener,
+                                                const UAISenseConfig_GeneralUtilityCone &SenseConfig) {
+    const UAIPerceptionComponent *component = Listener.Listener.Get();
+    AActor *bodyActor = component != nullptr ? component->GetBodyActor() : nullptr;
+
+    FCollisionQueryParams params(SCENE_QUERY_STAT(AIGeneralUtilityCone), SenseConfig.bTraceComplex, bodyActor);
+    FCollisionQueryParams lineOfSightParams(SCENE_QUERY_STAT(AIGeneralUtilityConeLineOfSight), true, bodyActor);
+    UWorld *world = GetWorld();
+
+    const uint8 affiliationFlags = SenseConfig.DetectionByAffiliation.GetAsFlags();
+    TSet<TWeakObjectPtr<AActor> > &perceived = PerceivedActors.FindOrAdd(Listener.GetListenerID());
+    TSet<TWeakObjectPtr<AActor> > seen;
+
+    UGeneralUtilityBPLibrary::VisitConeOverlapsForObject(
+            Listener.Listener.Get(), Listener.CachedLocation, Listener.CachedDirection.Rotation(),
+            SenseConfig.Distance, SenseConfig.HorizontalFieldOfView, SenseConfig.VerticalFieldOfView,
+            FCollisionObjectQueryParams(SenseConfig.ObjectTypes), params,
+            [&](const FOverlapResult &overlap) {
+                AActor *actor = overlap.GetActor();
+                if (seen.Contains(actor)
+                    || !FAISenseAffiliationFilter::ShouldSenseTeam(Listener.TeamIdentifier,
+                                                                   FGenericTeamId::GetTeamIdentifier(actor),
+                                                                   affiliationFlags)) {
+                    return EGeneralUtilityConeVisit::Continue;
+                }
+
+                if (SenseConfig.bTestLineOfSight && world != nullptr) {
+                    FCollisionQueryParams lineOfSight = lineOfSightParams;
+                    lineOfSight.AddIgnoredActor(actor);
+                    if (world->LineTraceTestByChannel(Listener.CachedLocation, actor->GetActorLocation(),
+                                                      SenseConfig.LineOfSightChannel, lineOfSight)) {
+                        return EGeneralUtilityConeVisit::Continue;
+                    }
+                }
+
+                seen.Add(actor);
+                Listener.RegisterStimulus(actor, FAIStimulus(*this, 1.f, actor->GetActorLocation(),
+                                                             Listener.CachedLocation));
+                return EGeneralUtilityConeVisit::Continue;
+            });
+
+    for (const TWeakObjectPtr<AActor> &previous : perceived) {
+        AActor *actor = previous.Get();
+        if (actor != nullptr && !seen.Contains(previous)) {
+            Listener.RegisterStimulus(actor, FAIStimulus(*this, 0.f, actor->GetActorLocation(),
+                                                         Listener.CachedLocation, FAIStimulus::SensingFailed));
+        }
+    }
+
+    perceived = MoveTemp(seen);
+}
+
+void UAISense_GeneralUtilityCone::OnNewListenerImpl(const FPerceptionListener &NewListener) {
+    QueryQueue.AddUnique(NewListener.GetListenerID());
+}
+
+void UAISense_GeneralUtilityCone::OnListenerUpdateImpl(const FPerceptionListener &UpdatedListener) {
+    if (UpdatedListener.HasSense(GetSenseID())) {
+        QueryQueue.AddUnique(UpdatedListener.GetListenerID());
+    } else {
+        OnListenerRemovedImpl(UpdatedListener);
+    }
+}
+
+void UAISense_GeneralUtilityCone::OnListenerRemovedImpl(const FPerceptionListener &RemovedListener) {
+    QueryQueue.Remove(RemovedListener.GetListenerID());
+    PerceivedActors.Remove(RemovedListener.GetListenerID());
+}
@@ -3,8 +3,439 @@
 #include <Engine/GameEngine.h>
 #include <DrawDebugHelpers.h>
 #include <Kismet/KismetMathLibrary.h>
+#include <Algo/BinarySearch.h>
 #include "GeneralUtilityBPLibrary.h"
 #include "GeneralUtility.h"
+#include "GeneralUtilityConeMath.h"
+#include "GeneralUtilityStaticTargetIndex.h"
+#include "GeneralUtilityVisionProfile.h"
+
+namespace {
+    /**
+     * Tests if a point was inside a cone at any point while the viewer moved linearly between two transforms.
+     * The yaw towards a fixed point changes monotonically along a line so the end points bound it, while the pitch
+     * has at most one extremum which is solved for directly. The resulting intervals are then tested for overlap with
+     * the intervals covered by the view over the motion
+     */
+    bool IsInSweptCone(const FVector &Point, const FVector &StartLocation, const FVector &EndLocation,
+                       const FRotator &StartRotation, const FRotator &EndRotation,
+                       float HalfHorizontalFieldOfView, float HalfVerticalFieldOfView) {
+        const FRotator startAngle = (Point - StartLocation).Rotation();
+        const FRotator endAngle = (Point - EndLocation).Rotation();
+
+        float targetYawSpan = FMath::FindDeltaAngleDegrees(startAngle.Yaw, endAngle.Yaw);
+        float viewYawSpan = FMath::FindDeltaAngleDegrees(StartRotation.Yaw, EndRotation.Yaw);
+        float yawGap = FMath::Abs(FMath::FindDeltaAngleDegrees(StartRotation.Yaw + viewYawSpan / 2.f,
+                                                               startAngle.Yaw + targetYawSpan / 2.f));
+
+        if (yawGap > (FMath::Abs(targetYawSpan) + FMath::Abs(viewYawSpan)) / 2.f + HalfHorizontalFieldOfView) {
+            return false;
+        }
+
+        float minPitch = FMath::Min(startAngle.Pitch, endAngle.Pitch);
+        float maxPitch = FMath::Max(startAngle.Pitch, endAngle.Pitch);
+
+        // With the offset to the point being (a + bt) vertically and sqrt(c + 2et + ft^2) horizontally the derivative
+        // of the pitch's tangent is zero at t = (ae - bc) / (be - af)
+        const FVector offset = Point - StartLocation;
+        const FVector motion = EndLocation - StartLocation;
+        float a = offset.Z;
+        float b = -motion.Z;
+        float c = offset.SizeSquared2D();
+        float e = -(offset.X * motion.X + offset.Y * motion.Y);
+        float f = motion.SizeSquared2D();
+        float denominator = b * e - a * f;
+
+        if (!FMath::IsNearlyZero(denominator)) {
+            float t = (a * e - b * c) / denominator;
+            if (t > 0.f && t < 1.f) {
+                float pitch = (Point - FMath::Lerp(StartLocation, EndLocation, t)).Rotation().Pitch;
+                minPitch = FMath::Min(minPitch, pitch);
+                maxPitch = FMath::Max(maxPitch, pitch);
+            }
+        }
+
+        float startViewPitch = FRotator::NormalizeAxis(StartRotation.Pitch);
+        float endViewPitch = FRotator::NormalizeAxis(EndRotation.Pitch);
+
+        return maxPitch >= FMath::Min(startViewPitch, endViewPitch) - HalfVerticalFieldOfView
+               && minPitch <= FMath::Max(startViewPitch, endViewPitch) + HalfVerticalFieldOfView;
+    }
+
+    /**
+     * Bins the actors of the hits that fall inside the grid's cone, each actor is only counted once no matter how many
+     * of its components were hit
+     */
+    bool BinHitsIntoOccupancyGrid(UObject *WorldContextObject, const TArray<FHitResult> &Hits,
+                                  const TArray<TSubclassOf<AActor>> &ClassFilter,
+                                  FGeneralUtilityConeOccupancyGrid &Grid, EDrawDebugTrace::Type DrawDebugType,
+                                  FLinearColor ActorColor, FLinearColor TraceHitColor, float DrawTime) {
+#if ENABLE_DRAW_DEBUG
+        UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+#endif
+
+        TSet<const AActor *> binned;
+        bool occupied = false;
+        int32 classCount = FMath::Min(ClassFilter.Num(), 32);
+
+        for (const FHitResult &hit : Hits) {
+            const AActor *actor = hit.GetActor();
+            if (actor == nullptr) {
+                continue;
+            }
+
+            bool alreadyBinned = false;
+            binned.Add(actor, &alreadyBinned);
+            if (alreadyBinned) {
+                continue;
+            }
+
+            FVector actorLocation = actor->GetActorLocation();
+            int32 index = Grid.GetBinIndex(actorLocation);
+
+#if ENABLE_DRAW_DEBUG
+            if (DrawDebugType != EDrawDebugTrace::None) {
+                ::DrawDebugPoint(World, actorLocation, 5,
+                                 (index != INDEX_NONE ? TraceHitColor : ActorColor).ToFColor(true),
+                                 DrawDebugType == EDrawDebugTrace::Persistent,
+                                 DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f);
+            }
+#endif
+
+            if (index == INDEX_NONE) {
+                continue;
+            }
+
+            FGeneralUtilityConeOccupancyBin &bin = Grid.Bins[index];
+            float distance = FVector::Dist(Grid.Location, actorLocation);
+            bin.NearestDistance = bin.Count == 0 ? distance : FMath::Min(bin.NearestDistance, distance);
+            bin.Count++;
+
+            for (int32 i = 0; i < classCount; i++) {
+                if (ClassFilter[i] != nullptr && actor->IsA(ClassFilter[i])) {
+                    bin.ClassMask |= static_cast<int32>(1u << i);
+                }
+            }
+            occupied = true;
+        }
+        return occupied;
+    }
+
+    /**
+     * Runs each band of a banded cone query with its own broadphase volume and collision complexity. The trace function
+     * is handed either a box or a sphere and fills in the hits for it, which are then limited to the band
+     */
+    template<typename TraceFunction>
+    void RunConeBands(const FVector &Location, const FRotator &ViewRotation, float HorizontalFieldOfView,
+                      float VerticalFieldOfView, const TArray<FGeneralUtilityConeBand> &Bands,
+                      const UGeneralUtilityStaticTargetIndex *StaticTargets, TraceFunction Trace,
+                      TArray<FHitResult> &OutHits, TArray<FGeneralUtilityStaticTargetHit> &OutStaticHits) {
+        const FGeneralUtilityConeWindow window(Location, ViewRotation, HorizontalFieldOfView, VerticalFieldOfView);
+        TArray<FHitResult> bandHits;
+        float nearDistance = 0.f;
+
+        for (const FGeneralUtilityConeBand &band : Bands) {
+            float farDistance = band.MaxDistance;
+            if (farDistance <= nearDistance) {
+                continue;
+            }
+
+            if (band.Query == EGeneralUtilityConeBandQuery::StaticTargets) {
+                if (StaticTargets != nullptr) {
+                    int32 first = OutStaticHits.Num();
+                    StaticTargets->QueryCone(Location, ViewRotation, farDistance, HorizontalFieldOfView,
+                                             VerticalFieldOfView, OutStaticHits);
+
+                    for (int32 i = OutStaticHits.Num() - 1; i >= first; i--) {
+                        if (OutStaticHits[i].Distance < nearDistance) {
+                            OutStaticHits.RemoveAtSwap(i, 1, false);
+                        }
+                    }
+                }
+            } else {
+                FVector center = Location;
+                FVector halfSize = FVector::ZeroVector;
+                FRotator orientation = FRotator::ZeroRotator;
+                bool bBox = window.GetSliceBox(nearDistance, farDistance, center, halfSize, orientation);
+
+                bandHits.Reset();
+                Trace(bBox, center, halfSize, orientation, farDistance,
+                      band.Query == EGeneralUtilityConeBandQuery::Complex, bandHits);
+
+                for (FHitResult &hit : bandHits) {
+                    AActor *actor = hit.GetActor();
+                    if (actor == nullptr) {
+                        continue;
+                    }
+
+                    float distanceSquared = FVector::DistSquared(Location, actor->GetActorLocation());
+                    if (distanceSquared >= FMath::Square(nearDistance) && distanceSquared < FMath::Square(farDistance)
+                        && window.Contains(actor->GetActorLocation())) {
+                        OutHits.Add(MoveTemp(hit));
+                    }
+                }
+            }
+            nearDistance = farDistance;
+        }
+    }
+
+    /** Packs a grid cell into a sortable key, 21 bits per axis */
+    uint64 GetGridCellKey(const FIntVector &Cell) {
+        constexpr int32 offset = 1 << 20;
+        constexpr uint64 mask = (1ull << 21) - 1;
+        return ((static_cast<uint64>(Cell.X + offset) & mask) << 42)
+               | ((static_cast<uint64>(Cell.Y + offset) & mask) << 21)
+               | (static_cast<uint64>(Cell.Z + offset) & mask);
+    }
+
+    /**
+     * Sets up the query params the same way the {@link UKismetSystemLibrary} traces do
+     */
+    FCollisionQueryParams ConfigureConeQueryParams(bool bTraceComplex, const TArray<AActor *> &ActorsToIgnore,
+                                                   bool bIgnoreSelf, UObject *WorldContextObject) {
+        FCollisionQueryParams params(SCENE_QUERY_STAT(GeneralUtilityConeOverlap), bTraceComplex);
+        params.AddIgnoredActors(ActorsToIgnore);
+
+        if (bIgnoreSelf) {
+            for (UObject *current = WorldContextObject; current != nullptr; current = current->GetOuter()) {
+                if (AActor *actor = Cast<AActor>(current)) {
+                    params.AddIgnoredActor(actor);
+                    break;
+                }
+            }
+        }
+        return params;
+    }
+
+    /**
+     * Picks the tighter of the cone's bounding box and its sphere as the shape to overlap with
+     */
+    FCollisionShape GetConeOverlapShape(const FGeneralUtilityConeWindow &Window, float Distance,
+                                        FVector &OutCenter, FQuat &OutRotation) {
+        FVector halfSize;
+        FRotator orientation;
+        if (Window.GetSliceBox(0.f, Distance, OutCenter, halfSize, orientation)) {
+            OutRotation = orientation.Quaternion();
+            return FCollisionShape::MakeBox(halfSize);
+        }
+
+        OutCenter = Window.Location;
+        OutRotation = FQuat::Identity;
+        return FCollisionShape::MakeSphere(Distance);
+    }
+
+    /**
+     * Runs an overlap query and calls the visitor for the overlaps whose actor lies within the cone, the rejected
+     * candidates never have anything built for them and the filtering ends as soon as the visitor asks to stop. When
+     * asked to the bounds are first tested for any overlap at all, so empty cones never gather anything
+     */
+    template<typename AnyTestFunction, typename OverlapFunction>
+    bool VisitOverlapsInCone(UObject *WorldContextObject, const FGeneralUtilityConeWindow &Window, float Distance,
+                             bool bTestAnyFirst, AnyTestFunction AnyTest, OverlapFunction Overlap,
+                             FGeneralUtilityConeVisitor Visitor) {
+        UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+        if (World == nullptr) {
+            return false;
+        }
+
+        FVector center;
+        FQuat rotation;
+        const FCollisionShape shape = GetConeOverlapShape(Window, Distance, center, rotation);
+
+        if (bTestAnyFirst && !AnyTest(World, center, rotation, shape)) {
+            return false;
+        }
+
+        TArray<FOverlapResult> overlaps;
+        Overlap(World, overlaps, center, rotation, shape);
+
+        const FGeneralUtilityConeTest test(Window, Distance);
+        bool visited = false;
+
+        for (const FOverlapResult &overlap : overlaps) {
+            AActor *actor = overlap.GetActor();
+            if (actor == nullptr || !test.Contains(actor->GetActorLocation())) {
+                continue;
+            }
+
+            visited = true;
+            if (Visitor(overlap) == EGeneralUtilityConeVisit::Stop) {
+                break;
+            }
+        }
+        return visited;
+    }
+
+    /**
+     * Builds a hit result for an overlap found in a cone, located at the overlap's actor
+     */
+    FHitResult MakeConeOverlapHit(const FVector &Location, const FOverlapResult &Overlap) {
+        const FVector actorLocation = Overlap.GetActor()->GetActorLocation();
+
+        FHitResult hit(Overlap.GetActor(), Overlap.GetComponent(), actorLocation,
+                       (Location - actorLocation).GetSafeNormal());
+        hit.bBlockingHit = Overlap.bBlockingHit;
+        hit.Item = Overlap.ItemIndex;
+        hit.TraceStart = Location;
+        hit.TraceEnd = actorLocation;
+        hit.Distance = FVector::Dist(Location, actorLocation);
+        return hit;
+    }
+
+    /**
+     * Overlaps the capsule the view's sphere sweeps out between two locations, an overlap does not stop at the first
+     * blocking body like a sweep does so everything that was within reach at any point of the motion is found
+     */
+    template<typename OverlapFunction>
+    void OverlapSweptSphere(UObject *WorldContextObject, const FVector &StartLocation, const FVector &EndLocation,
+                            float Distance, OverlapFunction Overlap, TArray<FHitResult> &OutHits) {
+        UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+        if (World == nullptr) {
+            return;
+        }
+
+        const FVector motion = EndLocation - StartLocation;
+        const FQuat rotation = motion.IsNearlyZero() ? FQuat::Identity : FRotationMatrix::MakeFromZ(motion).ToQuat();
+
+        TArray<FOverlapResult> overlaps;
+        Overlap(World, overlaps, (StartLocation + EndLocation) / 2.f, rotation,
+                FCollisionShape::MakeCapsule(Distance, Distance + motion.Size() / 2.f));
+
+        OutHits.Reserve(overlaps.Num());
+        for (const FOverlapResult &overlap : overlaps) {
+            if (overlap.GetActor() != nullptr) {
+                OutHits.Add(MakeConeOverlapHit(StartLocation, overlap));
+            }
+        }
+    }
+
+    /**
+     * Runs a single overlap covering every region of a profile and classifies each actor found into the first region
+     * it is within, actors are only reported once however many of their components overlap
+     */
+    template<typename OverlapFunction>
+    void OverlapIntoVisionProfile(UObject *WorldContextObject, const UGeneralUtilityVisionProfile &Profile,
+                                  const FVector &Location, const FRotator &ViewRotation, OverlapFunction Overlap,
+                                  TArray<FGeneralUtilityVisionHit> &OutHits) {
+        UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+        if (World == nullptr || Profile.Regions.Num() == 0) {
+            return;
+        }
+
+        TArray<FGeneralUtilityConeTest> tests;
+        tests.Reserve(Profile.Regions.Num());
+        for (const FGeneralUtilityVisionRegion &region : Profile.Regions) {
+            tests.Emplace(FGeneralUtilityConeWindow(Location, ViewRotation, region.HorizontalFieldOfView,
+                                                    region.VerticalFieldOfView), region.Distance);
+        }
+
+        TArray<FOverlapResult> overlaps;
+        Overlap(World, overlaps, Location, FQuat::Identity, FCollisionShape::MakeSphere(Profile.GetMaxDistance()));
+
+        TSet<const AActor *> seen;
+        for (const FOverlapResult &overlap : overlaps) {
+            const AActor *actor = overlap.GetActor();
+            if (actor == nullptr || seen.Contains(actor)) {
+                continue;
+            }
+
+            const FVector actorLocation = actor->GetActorLocation();
+            int32 regionIndex = tests.IndexOfByPredicate([&](const FGeneralUtilityConeTest &test) {
+                return test.Contains(actorLocation);
+            });
+            if (regionIndex == INDEX_NONE) {
+                continue;
+            }
+
+            seen.Add(actor);
+            FGeneralUtilityVisionHit &hit = OutHits.AddDefaulted_GetRef();
+            hit.Hit = MakeConeOverlapHit(Location, overlap);
+            hit.RegionTag = Profile.Regions[regionIndex].Tag;
+            hit.RegionIndex = regionIndex;
+        }
+    }
+
+#if ENABLE_DRAW_DEBUG
+
+    void DrawDebugSweptCone(UWorld *World, const FTransform &StartTransform, const FTransform &EndTransform,
+                            float Distance, float HorizontalFieldOfView, float VerticalFieldOfView,
+                            FLinearColor TraceColor, FLinearColor ScanColor, EDrawDebugTrace::Type DrawDebugType,
+                            float DrawTime) {
+        bool bPersistent = DrawDebugType == EDrawDebugTrace::Persistent;
+        float lifeTime = DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f;
+
+        ::DrawDebugAltCone(World, StartTransform.GetLocation(), StartTransform.Rotator(), Distance,
+                           FMath::DegreesToRadians(HorizontalFieldOfView),
+                           FMath::DegreesToRadians(VerticalFieldOfView), ScanColor.ToFColor(true),
+                           bPersistent, lifeTime);
+        ::DrawDebugAltCone(World, EndTransform.GetLocation(), EndTransform.Rotator(), Distance,
+                           FMath::DegreesToRadians(HorizontalFieldOfView),
+                           FMath::DegreesToRadians(VerticalFieldOfView), ScanColor.ToFColor(true),
+                           bPersistent, lifeTime);
+        ::DrawDebugLine(World, StartTransform.GetLocation(), EndTransform.GetLocation(), ScanColor.ToFColor(true),
+                        bPersistent, lifeTime);
+
+        const FVector motion = EndTransform.GetLocation() - StartTransform.GetLocation();
+        ::DrawDebugCapsule(World, (StartTransform.GetLocation() + EndTransform.GetLocation()) / 2.f,
+                           Distance + motion.Size() / 2.f, Distance,
+                           motion.IsNearlyZero() ? FQuat::Identity : FRotationMatrix::MakeFromZ(motion).ToQuat(),
+                           TraceColor.ToFColor(true), bPersistent, lifeTime);
+    }
+
+    void DrawDebugConeBands(UWorld *World, const FVector &Location, const FRotator &ViewRotation,
+                            float HorizontalFieldOfView, float VerticalFieldOfView,
+                            const TArray<FGeneralUtilityConeBand> &Bands, FLinearColor ScanColor,
+                            EDrawDebugTrace::Type DrawDebugType, float DrawTime) {
+        for (const FGeneralUtilityConeBand &band : Bands) {
+            ::DrawDebugAltCone(World, Location, ViewRotation, band.MaxDistance,
+                               FMath::DegreesToRadians(HorizontalFieldOfView),
+                               FMath::DegreesToRadians(VerticalFieldOfView), ScanColor.ToFColor(true),
+                               DrawDebugType == EDrawDebugTrace::Persistent,
+                               DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f);
+        }
+    }
+
+    void DrawDebugConeOverlap(UWorld *World, const FVector &Location, const FRotator &ViewRotation, float Distance,
+                              float HorizontalFieldOfView, float VerticalFieldOfView, const TArray<FHitResult> &Hits,
+                              FLinearColor ScanColor, FLinearColor TraceHitColor,
+                              EDrawDebugTrace::Type DrawDebugType, float DrawTime) {
+        bool bPersistent = DrawDebugType == EDrawDebugTrace::Persistent;
+        float lifeTime = DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f;
+
+        ::DrawDebugAltCone(World, Location, ViewRotation, Distance, FMath::DegreesToRadians(HorizontalFieldOfView),
+                           FMath::DegreesToRadians(VerticalFieldOfView), ScanColor.ToFColor(true),
+                           bPersistent, lifeTime);
+        for (const FHitResult &hit : Hits) {
+            ::DrawDebugPoint(World, hit.Location, 5, TraceHitColor.ToFColor(true), bPersistent, lifeTime);
+        }
+    }
+
+    void DrawDebugVisionProfile(UWorld *World, const UGeneralUtilityVisionProfile &Profile, const FVector &Location,
+                                const FRotator &ViewRotation, const TArray<FGeneralUtilityVisionHit> &Hits,
+                                FLinearColor ScanColor, FLinearColor TraceHitColor,
+                                EDrawDebugTrace::Type DrawDebugType, float DrawTime) {
+        bool bPersistent = DrawDebugType == EDrawDebugTrace::Persistent;
+        float lifeTime = DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f;
+
+        for (const FGeneralUtilityVisionRegion &region : Profile.Regions) {
+            if (region.HorizontalFieldOfView >= 360.f && region.VerticalFieldOfView >= 180.f) {
+                ::DrawDebugSphere(World, Location, region.Distance, 16, ScanColor.ToFColor(true), bPersistent,
+                                  lifeTime);
+            } else {
+                ::DrawDebugAltCone(World, Location, ViewRotation, region.Distance,
+                                   FMath::DegreesToRadians(region.HorizontalFieldOfView),
+                                   FMath::DegreesToRadians(region.VerticalFieldOfView), ScanColor.ToFColor(true),
+                                   bPersistent, lifeTime);
+            }
+        }
+
+        for (const FGeneralUtilityVisionHit &hit : Hits) {
+            ::DrawDebugPoint(World, hit.Hit.Location, 5, TraceHitColor.ToFColor(true), bPersistent, lifeTime);
+        }
+    }
+
+#endif
+}
 
 bool UGeneralUtilityBPLibrary::ConeCapsuleTraceMultiForObject(UObject *WorldContextObject, FVector Location,
                                                               FVector Orientation, FRotator ViewRotation,
@@ -392,6 +823,844 @@ UGeneralUtilityBPLibrary::ConeBoxTraceMultiByChannel(UObject *WorldContextObject
     return OutHits.Num() > 0;
 }
 
+bool UGeneralUtilityBPLibrary::ConeSweptOverlapMultiForObject(UObject *WorldContextObject,
+                                                              const FTransform &StartTransform,
+                                                              const FTransform &EndTransform, float Distance,
+                                                              float HorizontalFieldOfView,
+                                                              float VerticalFieldOfView,
+                                                              const TArray<TEnumAsByte<EObjectTypeQuery>> &ObjectTypes,
+                                                              bool bTraceComplex,
+                                                              const TArray<AActor *> &ActorsToIgnore,
+                                                              EDrawDebugTrace::Type DrawDebugType,
+                                                              TArray<FHitResult> &OutHits, bool bIgnoreSelf,
+                                                              FLinearColor TraceColor, FLinearColor TraceHitColor,
+                                                              FLinearColor ScanColor, FLinearColor ActorColor,
+                                                              float DrawTime) {
+    OutHits.Reset();
+
+    FCollisionObjectQueryParams objectParams(ObjectTypes);
+    if (!objectParams.IsValid()) {
+        return false;
+    }
+
+    const FCollisionQueryParams params = ConfigureConeQueryParams(bTraceComplex, ActorsToIgnore, bIgnoreSelf,
+                                                                  WorldContextObject);
+    OverlapSweptSphere(WorldContextObject, StartTransform.GetLocation(), EndTransform.GetLocation(), Distance,
+                       [&](UWorld *world, TArray<FOverlapResult> &overlaps, const FVector &center,
+                           const FQuat &rotation, const FCollisionShape &shape) {
+                           world->OverlapMultiByObjectType(overlaps, center, rotation, objectParams, shape, params);
+                       }, OutHits);
+
+    if (OutHits.Num() > 0) {
+        UGeneralUtilityBPLibrary::FilterItemsIntoSweptCone(WorldContextObject, StartTransform, EndTransform,
+                                                           HorizontalFieldOfView, VerticalFieldOfView, OutHits,
+                                                           DrawDebugType, ActorColor, TraceHitColor, DrawTime);
+
+#if ENABLE_DRAW_DEBUG
+        UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+        if (DrawDebugType != EDrawDebugTrace::None) {
+            DrawDebugSweptCone(World, StartTransform, EndTransform, Distance, HorizontalFieldOfView,
+                               VerticalFieldOfView, TraceColor, ScanColor, DrawDebugType, DrawTime);
+        }
+#endif
+    }
+    return OutHits.Num() > 0;
+}
+
+bool UGeneralUtilityBPLibrary::ConeSweptOverlapMultiByProfile(UObject *WorldContextObject,
+                                                              const FTransform &StartTransform,
+                                                              const FTransform &EndTransform, float Distance,
+                                                              float HorizontalFieldOfView,
+                                                              float VerticalFieldOfView,
+                                                              FName ProfileName, bool bTraceComplex,
+                                                              const TArray<AActor *> &ActorsToIgnore,
+                                                              EDrawDebugTrace::Type DrawDebugType,
+                                                              TArray<FHitResult> &OutHits, bool bIgnoreSelf,
+                                                              FLinearColor TraceColor,
+                                                              FLinearColor TraceHitColor,
+                                                              FLinearColor ScanColor,
+                                                              FLinearColor ActorColor,
+                                                              float DrawTime) {
+    OutHits.Reset();
+
+    const FCollisionQueryParams params = ConfigureConeQueryParams(bTraceComplex, ActorsToIgnore, bIgnoreSelf,
+                                                                  WorldContextObject);
+    OverlapSweptSphere(WorldContextObject, StartTransform.GetLocation(), EndTransform.GetLocation(), Distance,
+                       [&](UWorld *world, TArray<FOverlapResult> &overlaps, const FVector &center,
+                           const FQuat &rotation, const FCollisionShape &shape) {
+                           world->OverlapMultiByProfile(overlaps, center, rotation, ProfileName, shape, params);
+                       }, OutHits);
+
+    if (OutHits.Num() > 0) {
+        UGeneralUtilityBPLibrary::FilterItemsIntoSweptCone(WorldContextObject, StartTransform, EndTransform,
+                                                           HorizontalFieldOfView, VerticalFieldOfView, OutHits,
+                                                           DrawDebugType, ActorColor, TraceHitColor, DrawTime);
+
+#if ENABLE_DRAW_DEBUG
+        UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+        if (DrawDebugType != EDrawDebugTrace::None) {
+            DrawDebugSweptCone(World, StartTransform, EndTransform, Distance, HorizontalFieldOfView,
+                               VerticalFieldOfView, TraceColor, ScanColor, DrawDebugType, DrawTime);
+        }
+#endif
+    }
+    return OutHits.Num() > 0;
+}
+
+bool
+UGeneralUtilityBPLibrary::ConeSweptOverlapMultiByChannel(UObject *WorldContextObject,
+                                                         const FTransform &StartTransform,
+                                                         const FTransform &EndTransform, float Distance,
+                                                         float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                         ETraceTypeQuery TraceChannel, bool bTraceComplex,
+                                                         const TArray<AActor *> &ActorsToIgnore,
+                                                         EDrawDebugTrace::Type DrawDebugType,
+                                                         TArray<FHitResult> &OutHits, bool bIgnoreSelf,
+                                                         FLinearColor TraceColor,
+                                                         FLinearColor TraceHitColor,
+                                                         FLinearColor ScanColor,
+                                                         FLinearColor ActorColor,
+                                                         float DrawTime) {
+    OutHits.Reset();
+
+    const FCollisionQueryParams params = ConfigureConeQueryParams(bTraceComplex, ActorsToIgnore, bIgnoreSelf,
+                                                                  WorldContextObject);
+    OverlapSweptSphere(WorldContextObject, StartTransform.GetLocation(), EndTransform.GetLocation(), Distance,
+                       [&](UWorld *world, TArray<FOverlapResult> &overlaps, const FVector &center,
+                           const FQuat &rotation, const FCollisionShape &shape) {
+                           world->OverlapMultiByChannel(overlaps, center, rotation,
+                                                        UEngineTypes::ConvertToCollisionChannel(TraceChannel), shape,
+                                                        params);
+                       }, OutHits);
+
+    if (OutHits.Num() > 0) {
+        UGeneralUtilityBPLibrary::FilterItemsIntoSweptCone(WorldContextObject, StartTransform, EndTransform,
+                                                           HorizontalFieldOfView, VerticalFieldOfView, OutHits,
+                                                           DrawDebugType, ActorColor, TraceHitColor, DrawTime);
+
+#if ENABLE_DRAW_DEBUG
+        UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+        if (DrawDebugType != EDrawDebugTrace::None) {
+            DrawDebugSweptCone(World, StartTransform, EndTransform, Distance, HorizontalFieldOfView,
+                               VerticalFieldOfView, TraceColor, ScanColor, DrawDebugType, DrawTime);
+        }
+#endif
+    }
+    return OutHits.Num() > 0;
+}
+
+bool UGeneralUtilityBPLibrary::ConeSphereOccupancyForObject(UObject *WorldContextObject, FVector Location,
+                                                            FRotator ViewRotation, float Distance,
+                                                            float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                            int32 YawBins, int32 PitchBins,
+                                                            const TArray<TEnumAsByte<EObjectTypeQuery>> &ObjectTypes,
+                                                            bool bTraceComplex,
+                                                            const TArray<AActor *> &ActorsToIgnore,
+                                                            const TArray<TSubclassOf<AActor>> &ClassFilter,
+                                                            EDrawDebugTrace::Type DrawDebugType,
+                                                            FGeneralUtilityConeOccupancyGrid &OutGrid, bool bIgnoreSelf,
+                                                            FLinearColor TraceColor, FLinearColor TraceHitColor,
+                                                            FLinearColor ScanColor, FLinearColor ActorColor,
+                                                            float DrawTime) {
+    TArray<FHitResult> hits;
+    UKismetSystemLibrary::SphereTraceMultiForObjects(WorldContextObject,
+                                                     Location, Location,
+                                                     Distance, ObjectTypes, bTraceComplex, ActorsToIgnore,
+                                                     DrawDebugType, hits, bIgnoreSelf, TraceColor,
+                                                     TraceHitColor, DrawTime);
+
+    OutGrid.Reset(Location, ViewRotation, HorizontalFieldOfView, VerticalFieldOfView, YawBins, PitchBins);
+    bool occupied = BinHitsIntoOccupancyGrid(WorldContextObject, hits, ClassFilter, OutGrid, DrawDebugType,
+                                             ActorColor, TraceHitColor, DrawTime);
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        ::DrawDebugAltCone(World, Location, ViewRotation, Distance, FMath::DegreesToRadians(HorizontalFieldOfView),
+                           FMath::DegreesToRadians(VerticalFieldOfView), ScanColor.ToFColor(true),
+                           DrawDebugType == EDrawDebugTrace::Persistent,
+                           DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f);
+    }
+#endif
+    return occupied;
+}
+
+bool UGeneralUtilityBPLibrary::ConeSphereOccupancyByProfile(UObject *WorldContextObject, FVector Location,
+                                                            FRotator ViewRotation, float Distance,
+                                                            float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                            int32 YawBins, int32 PitchBins,
+                                                            FName ProfileName, bool bTraceComplex,
+                                                            const TArray<AActor *> &ActorsToIgnore,
+                                                            const TArray<TSubclassOf<AActor>> &ClassFilter,
+                                                            EDrawDebugTrace::Type DrawDebugType,
+                                                            FGeneralUtilityConeOccupancyGrid &OutGrid, bool bIgnoreSelf,
+                                                            FLinearColor TraceColor,
+                                                            FLinearColor TraceHitColor,
+                                                            FLinearColor ScanColor,
+                                                            FLinearColor ActorColor,
+                                                            float DrawTime) {
+    TArray<FHitResult> hits;
+    UKismetSystemLibrary::SphereTraceMultiByProfile(WorldContextObject,
+                                                    Location, Location,
+                                                    Distance, ProfileName, bTraceComplex, ActorsToIgnore,
+                                                    DrawDebugType, hits, bIgnoreSelf, TraceColor,
+                                                    TraceHitColor, DrawTime);
+
+    OutGrid.Reset(Location, ViewRotation, HorizontalFieldOfView, VerticalFieldOfView, YawBins, PitchBins);
+    bool occupied = BinHitsIntoOccupancyGrid(WorldContextObject, hits, ClassFilter, OutGrid, DrawDebugType,
+                                             ActorColor, TraceHitColor, DrawTime);
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        ::DrawDebugAltCone(World, Location, ViewRotation, Distance, FMath::DegreesToRadians(HorizontalFieldOfView),
+                           FMath::DegreesToRadians(VerticalFieldOfView), ScanColor.ToFColor(true),
+                           DrawDebugType == EDrawDebugTrace::Persistent,
+                           DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f);
+    }
+#endif
+    return occupied;
+}
+
+bool
+UGeneralUtilityBPLibrary::ConeSphereOccupancyByChannel(UObject *WorldContextObject, FVector Location,
+                                                       FRotator ViewRotation, float Distance,
+                                                       float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                       int32 YawBins, int32 PitchBins,
+                                                       ETraceTypeQuery TraceChannel, bool bTraceComplex,
+                                                       const TArray<AActor *> &ActorsToIgnore,
+                                                       const TArray<TSubclassOf<AActor>> &ClassFilter,
+                                                       EDrawDebugTrace::Type DrawDebugType,
+                                                       FGeneralUtilityConeOccupancyGrid &OutGrid, bool bIgnoreSelf,
+                                                       FLinearColor TraceColor,
+                                                       FLinearColor TraceHitColor,
+                                                       FLinearColor ScanColor,
+                                                       FLinearColor ActorColor,
+                                                       float DrawTime) {
+    TArray<FHitResult> hits;
+    UKismetSystemLibrary::SphereTraceMulti(WorldContextObject,
+                                           Location, Location,
+                                           Distance, TraceChannel, bTraceComplex, ActorsToIgnore,
+                                           DrawDebugType, hits, bIgnoreSelf, TraceColor,
+                                           TraceHitColor, DrawTime);
+
+    OutGrid.Reset(Location, ViewRotation, HorizontalFieldOfView, VerticalFieldOfView, YawBins, PitchBins);
+    bool occupied = BinHitsIntoOccupancyGrid(WorldContextObject, hits, ClassFilter, OutGrid, DrawDebugType,
+                                             ActorColor, TraceHitColor, DrawTime);
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        ::DrawDebugAltCone(World, Location, ViewRotation, Distance, FMath::DegreesToRadians(HorizontalFieldOfView),
+                           FMath::DegreesToRadians(VerticalFieldOfView), ScanColor.ToFColor(true),
+                           DrawDebugType == EDrawDebugTrace::Persistent,
+                           DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f);
+    }
+#endif
+    return occupied;
+}
+
+bool UGeneralUtilityBPLibrary::ConeQueryStaticTargets(UObject *WorldContextObject,
+                                                      const UGeneralUtilityStaticTargetIndex *StaticTargets,
+                                                      FVector Location, FRotator ViewRotation, float Distance,
+                                                      float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                      EDrawDebugTrace::Type DrawDebugType,
+                                                      TArray<FGeneralUtilityStaticTargetHit> &OutHits,
+                                                      FLinearColor ScanColor, FLinearColor TraceHitColor,
+                                                      float DrawTime) {
+    OutHits.Reset();
+
+    if (StaticTargets != nullptr) {
+        StaticTargets->QueryCone(Location, ViewRotation, Distance, HorizontalFieldOfView, VerticalFieldOfView,
+                                 OutHits);
+    }
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        ::DrawDebugAltCone(World, Location, ViewRotation, Distance, FMath::DegreesToRadians(HorizontalFieldOfView),
+                           FMath::DegreesToRadians(VerticalFieldOfView), ScanColor.ToFColor(true),
+                           DrawDebugType == EDrawDebugTrace::Persistent,
+                           DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f);
+
+        for (const FGeneralUtilityStaticTargetHit &hit : OutHits) {
+            ::DrawDebugPoint(World, hit.Location, 5, TraceHitColor.ToFColor(true),
+                             DrawDebugType == EDrawDebugTrace::Persistent,
+                             DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f);
+        }
+    }
+#endif
+    return OutHits.Num() > 0;
+}
+
+bool UGeneralUtilityBPLibrary::ConeBandedTraceMultiForObject(UObject *WorldContextObject, FVector Location,
+                                                             FRotator ViewRotation,
+                                                             float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                             const TArray<FGeneralUtilityConeBand> &Bands,
+                                                             const UGeneralUtilityStaticTargetIndex *StaticTargets,
+                                                             const TArray<TEnumAsByte<EObjectTypeQuery>> &ObjectTypes,
+                                                             const TArray<AActor *> &ActorsToIgnore,
+                                                             EDrawDebugTrace::Type DrawDebugType,
+                                                             TArray<FHitResult> &OutHits,
+                                                             TArray<FGeneralUtilityStaticTargetHit> &OutStaticHits,
+                                                             bool bIgnoreSelf, FLinearColor TraceColor,
+                                                             FLinearColor TraceHitColor, FLinearColor ScanColor,
+                                                             float DrawTime) {
+    OutHits.Reset();
+    OutStaticHits.Reset();
+
+    auto trace = [&](bool bBox, const FVector &Center, const FVector &HalfSize, const FRotator &Orientation,
+                     float Radius, bool bTraceComplex, TArray<FHitResult> &Hits) {
+        if (bBox) {
+            UKismetSystemLibrary::BoxTraceMultiForObjects(WorldContextObject, Center, Center, HalfSize, Orientation,
+                                                          ObjectTypes, bTraceComplex, ActorsToIgnore, DrawDebugType,
+                                                          Hits, bIgnoreSelf, TraceColor, TraceHitColor, DrawTime);
+        } else {
+            UKismetSystemLibrary::SphereTraceMultiForObjects(WorldContextObject, Center, Center, Radius, ObjectTypes,
+                                                             bTraceComplex, ActorsToIgnore, DrawDebugType, Hits,
+                                                             bIgnoreSelf, TraceColor, TraceHitColor, DrawTime);
+        }
+    };
+
+    RunConeBands(Location, ViewRotation, HorizontalFieldOfView, VerticalFieldOfView, Bands, StaticTargets, trace,
+                 OutHits, OutStaticHits);
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        DrawDebugConeBands(World, Location, ViewRotation, HorizontalFieldOfView, VerticalFieldOfView, Bands,
+                           ScanColor, DrawDebugType, DrawTime);
+    }
+#endif
+    return OutHits.Num() > 0 || OutStaticHits.Num() > 0;
+}
+
+bool UGeneralUtilityBPLibrary::ConeBandedTraceMultiByProfile(UObject *WorldContextObject, FVector Location,
+                                                             FRotator ViewRotation,
+                                                             float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                             const TArray<FGeneralUtilityConeBand> &Bands,
+                                                             const UGeneralUtilityStaticTargetIndex *StaticTargets,
+                                                             FName ProfileName,
+                                                             const TArray<AActor *> &ActorsToIgnore,
+                                                             EDrawDebugTrace::Type DrawDebugType,
+                                                             TArray<FHitResult> &OutHits,
+                                                             TArray<FGeneralUtilityStaticTargetHit> &OutStaticHits,
+                                                             bool bIgnoreSelf, FLinearColor TraceColor,
+                                                             FLinearColor TraceHitColor, FLinearColor ScanColor,
+                                                             float DrawTime) {
+    OutHits.Reset();
+    OutStaticHits.Reset();
+
+    auto trace = [&](bool bBox, const FVector &Center, const FVector &HalfSize, const FRotator &Orientation,
+                     float Radius, bool bTraceComplex, TArray<FHitResult> &Hits) {
+        if (bBox) {
+            UKismetSystemLibrary::BoxTraceMultiByProfile(WorldContextObject, Center, Center, HalfSize, Orientation,
+                                                         ProfileName, bTraceComplex, ActorsToIgnore, DrawDebugType,
+                                                         Hits, bIgnoreSelf, TraceColor, TraceHitColor, DrawTime);
+        } else {
+            UKismetSystemLibrary::SphereTraceMultiByProfile(WorldContextObject, Center, Center, Radius, ProfileName,
+                                                            bTraceComplex, ActorsToIgnore, DrawDebugType, Hits,
+                                                            bIgnoreSelf, TraceColor, TraceHitColor, DrawTime);
+        }
+    };
+
+    RunConeBands(Location, ViewRotation, HorizontalFieldOfView, VerticalFieldOfView, Bands, StaticTargets, trace,
+                 OutHits, OutStaticHits);
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        DrawDebugConeBands(World, Location, ViewRotation, HorizontalFieldOfView, VerticalFieldOfView, Bands,
+                           ScanColor, DrawDebugType, DrawTime);
+    }
+#endif
+    return OutHits.Num() > 0 || OutStaticHits.Num() > 0;
+}
+
+bool UGeneralUtilityBPLibrary::ConeBandedTraceMultiByChannel(UObject *WorldContextObject, FVector Location,
+                                                             FRotator ViewRotation,
+                                                             float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                             const TArray<FGeneralUtilityConeBand> &Bands,
+                                                             const UGeneralUtilityStaticTargetIndex *StaticTargets,
+                                                             ETraceTypeQuery TraceChannel,
+                                                             const TArray<AActor *> &ActorsToIgnore,
+                                                             EDrawDebugTrace::Type DrawDebugType,
+                                                             TArray<FHitResult> &OutHits,
+                                                             TArray<FGeneralUtilityStaticTargetHit> &OutStaticHits,
+                                                             bool bIgnoreSelf, FLinearColor TraceColor,
+                                                             FLinearColor TraceHitColor, FLinearColor ScanColor,
+                                                             float DrawTime) {
+    OutHits.Reset();
+    OutStaticHits.Reset();
+
+    auto trace = [&](bool bBox, const FVector &Center, const FVector &HalfSize, const FRotator &Orientation,
+                     float Radius, bool bTraceComplex, TArray<FHitResult> &Hits) {
+        if (bBox) {
+            UKismetSystemLibrary::BoxTraceMulti(WorldContextObject, Center, Center, HalfSize, Orientation, TraceChannel,
+                                                bTraceComplex, ActorsToIgnore, DrawDebugType, Hits, bIgnoreSelf,
+                                                TraceColor, TraceHitColor, DrawTime);
+        } else {
+            UKismetSystemLibrary::SphereTraceMulti(WorldContextObject, Center, Center, Radius, TraceChannel,
+                                                   bTraceComplex, ActorsToIgnore, DrawDebugType, Hits, bIgnoreSelf,
+                                                   TraceColor, TraceHitColor, DrawTime);
+        }
+    };
+
+    RunConeBands(Location, ViewRotation, HorizontalFieldOfView, VerticalFieldOfView, Bands, StaticTargets, trace,
+                 OutHits, OutStaticHits);
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        DrawDebugConeBands(World, Location, ViewRotation, HorizontalFieldOfView, VerticalFieldOfView, Bands,
+                           ScanColor, DrawDebugType, DrawTime);
+    }
+#endif
+    return OutHits.Num() > 0 || OutStaticHits.Num() > 0;
+}
+
+bool UGeneralUtilityBPLibrary::ConeOverlapMultiForObject(UObject *WorldContextObject, FVector Location,
+                                                         FRotator ViewRotation, float Distance,
+                                                         float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                         const TArray<TEnumAsByte<EObjectTypeQuery>> &ObjectTypes,
+                                                         bool bTraceComplex,
+                                                         const TArray<AActor *> &ActorsToIgnore,
+                                                         EDrawDebugTrace::Type DrawDebugType,
+                                                         TArray<FHitResult> &OutHits, bool bIgnoreSelf,
+                                                         FLinearColor ScanColor, FLinearColor TraceHitColor,
+                                                         float DrawTime) {
+    OutHits.Reset();
+    VisitConeOverlapsForObject(WorldContextObject, Location, ViewRotation, Distance, HorizontalFieldOfView,
+                               VerticalFieldOfView, FCollisionObjectQueryParams(ObjectTypes),
+                               ConfigureConeQueryParams(bTraceComplex, ActorsToIgnore, bIgnoreSelf,
+                                                        WorldContextObject),
+                               [&](const FOverlapResult &overlap) {
+                                   OutHits.Add(MakeConeOverlapHit(Location, overlap));
+                                   return EGeneralUtilityConeVisit::Continue;
+                               });
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        DrawDebugConeOverlap(World, Location, ViewRotation, Distance, HorizontalFieldOfView, VerticalFieldOfView,
+                             OutHits, ScanColor, TraceHitColor, DrawDebugType, DrawTime);
+    }
+#endif
+    return OutHits.Num() > 0;
+}
+
+bool UGeneralUtilityBPLibrary::ConeOverlapMultiByProfile(UObject *WorldContextObject, FVector Location,
+                                                         FRotator ViewRotation, float Distance,
+                                                         float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                         FName ProfileName, bool bTraceComplex,
+                                                         const TArray<AActor *> &ActorsToIgnore,
+                                                         EDrawDebugTrace::Type DrawDebugType,
+                                                         TArray<FHitResult> &OutHits, bool bIgnoreSelf,
+                                                         FLinearColor ScanColor, FLinearColor TraceHitColor,
+                                                         float DrawTime) {
+    OutHits.Reset();
+    VisitConeOverlapsByProfile(WorldContextObject, Location, ViewRotation, Distance, HorizontalFieldOfView,
+                               VerticalFieldOfView, ProfileName,
+                               ConfigureConeQueryParams(bTraceComplex, ActorsToIgnore, bIgnoreSelf,
+                                                        WorldContextObject),
+                               [&](const FOverlapResult &overlap) {
+                                   OutHits.Add(MakeConeOverlapHit(Location, overlap));
+                                   return EGeneralUtilityConeVisit::Continue;
+                               });
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        DrawDebugConeOverlap(World, Location, ViewRotation, Distance, HorizontalFieldOfView, VerticalFieldOfView,
+                             OutHits, ScanColor, TraceHitColor, DrawDebugType, DrawTime);
+    }
+#endif
+    return OutHits.Num() > 0;
+}
+
+bool UGeneralUtilityBPLibrary::ConeOverlapMultiByChannel(UObject *WorldContextObject, FVector Location,
+                                                         FRotator ViewRotation, float Distance,
+                                                         float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                         ETraceTypeQuery TraceChannel, bool bTraceComplex,
+                                                         const TArray<AActor *> &ActorsToIgnore,
+                                                         EDrawDebugTrace::Type DrawDebugType,
+                                                         TArray<FHitResult> &OutHits, bool bIgnoreSelf,
+                                                         FLinearColor ScanColor, FLinearColor TraceHitColor,
+                                                         float DrawTime) {
+    OutHits.Reset();
+    VisitConeOverlapsByChannel(WorldContextObject, Location, ViewRotation, Distance, HorizontalFieldOfView,
+                               VerticalFieldOfView, UEngineTypes::ConvertToCollisionChannel(TraceChannel),
+                               ConfigureConeQueryParams(bTraceComplex, ActorsToIgnore, bIgnoreSelf,
+                                                        WorldContextObject),
+                               [&](const FOverlapResult &overlap) {
+                                   OutHits.Add(MakeConeOverlapHit(Location, overlap));
+                                   return EGeneralUtilityConeVisit::Continue;
+                               });
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        DrawDebugConeOverlap(World, Location, ViewRotation, Distance, HorizontalFieldOfView, VerticalFieldOfView,
+                             OutHits, ScanColor, TraceHitColor, DrawDebugType, DrawTime);
+    }
+#endif
+    return OutHits.Num() > 0;
+}
+
+bool UGeneralUtilityBPLibrary::ConeTestAnyForObject(UObject *WorldContextObject, FVector Location,
+                                                    FRotator ViewRotation, float Distance,
+                                                    float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                    const TArray<TEnumAsByte<EObjectTypeQuery>> &ObjectTypes,
+                                                    bool bTraceComplex,
+                                                    const TArray<AActor *> &ActorsToIgnore,
+                                                    EDrawDebugTrace::Type DrawDebugType, FHitResult &OutHit,
+                                                    bool bIgnoreSelf, FLinearColor ScanColor,
+                                                    FLinearColor TraceHitColor, float DrawTime) {
+    OutHit.Reset(0.f, false);
+    bool found = VisitConeOverlapsForObject(WorldContextObject, Location, ViewRotation, Distance,
+                                            HorizontalFieldOfView, VerticalFieldOfView,
+                                            FCollisionObjectQueryParams(ObjectTypes),
+                                            ConfigureConeQueryParams(bTraceComplex, ActorsToIgnore, bIgnoreSelf,
+                                                                     WorldContextObject),
+                                            [&](const FOverlapResult &overlap) {
+                                                OutHit = MakeConeOverlapHit(Location, overlap);
+                                                return EGeneralUtilityConeVisit::Stop;
+                                            });
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        DrawDebugConeOverlap(World, Location, ViewRotation, Distance, HorizontalFieldOfView, VerticalFieldOfView,
+                             found ? TArray<FHitResult>{OutHit} : TArray<FHitResult>(), ScanColor, TraceHitColor,
+                             DrawDebugType, DrawTime);
+    }
+#endif
+    return found;
+}
+
+bool UGeneralUtilityBPLibrary::ConeTestAnyByProfile(UObject *WorldContextObject, FVector Location,
+                                                    FRotator ViewRotation, float Distance,
+                                                    float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                    FName ProfileName, bool bTraceComplex,
+                                                    const TArray<AActor *> &ActorsToIgnore,
+                                                    EDrawDebugTrace::Type DrawDebugType, FHitResult &OutHit,
+                                                    bool bIgnoreSelf, FLinearColor ScanColor,
+                                                    FLinearColor TraceHitColor, float DrawTime) {
+    OutHit.Reset(0.f, false);
+    bool found = VisitConeOverlapsByProfile(WorldContextObject, Location, ViewRotation, Distance,
+                                            HorizontalFieldOfView, VerticalFieldOfView, ProfileName,
+                                            ConfigureConeQueryParams(bTraceComplex, ActorsToIgnore, bIgnoreSelf,
+                                                                     WorldContextObject),
+                                            [&](const FOverlapResult &overlap) {
+                                                OutHit = MakeConeOverlapHit(Location, overlap);
+                                                return EGeneralUtilityConeVisit::Stop;
+                                            });
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        DrawDebugConeOverlap(World, Location, ViewRotation, Distance, HorizontalFieldOfView, VerticalFieldOfView,
+                             found ? TArray<FHitResult>{OutHit} : TArray<FHitResult>(), ScanColor, TraceHitColor,
+                             DrawDebugType, DrawTime);
+    }
+#endif
+    return found;
+}
+
+bool UGeneralUtilityBPLibrary::ConeTestAnyByChannel(UObject *WorldContextObject, FVector Location,
+                                                    FRotator ViewRotation, float Distance,
+                                                    float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                    ETraceTypeQuery TraceChannel, bool bTraceComplex,
+                                                    const TArray<AActor *> &ActorsToIgnore,
+                                                    EDrawDebugTrace::Type DrawDebugType, FHitResult &OutHit,
+                                                    bool bIgnoreSelf, FLinearColor ScanColor,
+                                                    FLinearColor TraceHitColor, float DrawTime) {
+    OutHit.Reset(0.f, false);
+    bool found = VisitConeOverlapsByChannel(WorldContextObject, Location, ViewRotation, Distance,
+                                            HorizontalFieldOfView, VerticalFieldOfView,
+                                            UEngineTypes::ConvertToCollisionChannel(TraceChannel),
+                                            ConfigureConeQueryParams(bTraceComplex, ActorsToIgnore, bIgnoreSelf,
+                                                                     WorldContextObject),
+                                            [&](const FOverlapResult &overlap) {
+                                                OutHit = MakeConeOverlapHit(Location, overlap);
+                                                return EGeneralUtilityConeVisit::Stop;
+                                            });
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        DrawDebugConeOverlap(World, Location, ViewRotation, Distance, HorizontalFieldOfView, VerticalFieldOfView,
+                             found ? TArray<FHitResult>{OutHit} : TArray<FHitResult>(), ScanColor, TraceHitColor,
+                             DrawDebugType, DrawTime);
+    }
+#endif
+    return found;
+}
+
+bool UGeneralUtilityBPLibrary::ConeVisionProfileForObject(UObject *WorldContextObject,
+                                                          const UGeneralUtilityVisionProfile *Profile,
+                                                          FVector Location, FRotator ViewRotation,
+                                                          const TArray<TEnumAsByte<EObjectTypeQuery>> &ObjectTypes,
+                                                          bool bTraceComplex,
+                                                          const TArray<AActor *> &ActorsToIgnore,
+                                                          EDrawDebugTrace::Type DrawDebugType,
+                                                          TArray<FGeneralUtilityVisionHit> &OutHits,
+                                                          bool bIgnoreSelf, FLinearColor ScanColor,
+                                                          FLinearColor TraceHitColor, float DrawTime) {
+    OutHits.Reset();
+    if (Profile == nullptr) {
+        return false;
+    }
+
+    FCollisionObjectQueryParams objectParams(ObjectTypes);
+    if (!objectParams.IsValid()) {
+        return false;
+    }
+
+    const FCollisionQueryParams params = ConfigureConeQueryParams(bTraceComplex, ActorsToIgnore, bIgnoreSelf,
+                                                                  WorldContextObject);
+    OverlapIntoVisionProfile(WorldContextObject, *Profile, Location, ViewRotation,
+                             [&](UWorld *world, TArray<FOverlapResult> &overlaps, const FVector &center,
+                                 const FQuat &rotation, const FCollisionShape &shape) {
+                                 world->OverlapMultiByObjectType(overlaps, center, rotation, objectParams, shape,
+                                                                 params);
+                             }, OutHits);
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        DrawDebugVisionProfile(World, *Profile, Location, ViewRotation, OutHits, ScanColor, TraceHitColor,
+                               DrawDebugType, DrawTime);
+    }
+#endif
+    return OutHits.Num() > 0;
+}
+
+bool UGeneralUtilityBPLibrary::ConeVisionProfileByProfile(UObject *WorldContextObject,
+                                                          const UGeneralUtilityVisionProfile *Profile,
+                                                          FVector Location, FRotator ViewRotation,
+                                                          FName ProfileName, bool bTraceComplex,
+                                                          const TArray<AActor *> &ActorsToIgnore,
+                                                          EDrawDebugTrace::Type DrawDebugType,
+                                                          TArray<FGeneralUtilityVisionHit> &OutHits,
+                                                          bool bIgnoreSelf, FLinearColor ScanColor,
+                                                          FLinearColor TraceHitColor, float DrawTime) {
+    OutHits.Reset();
+    if (Profile == nullptr) {
+        return false;
+    }
+
+    const FCollisionQueryParams params = ConfigureConeQueryParams(bTraceComplex, ActorsToIgnore, bIgnoreSelf,
+                                                                  WorldContextObject);
+    OverlapIntoVisionProfile(WorldContextObject, *Profile, Location, ViewRotation,
+                             [&](UWorld *world, TArray<FOverlapResult> &overlaps, const FVector &center,
+                                 const FQuat &rotation, const FCollisionShape &shape) {
+                                 world->OverlapMultiByProfile(overlaps, center, rotation, ProfileName, shape, params);
+                             }, OutHits);
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        DrawDebugVisionProfile(World, *Profile, Location, ViewRotation, OutHits, ScanColor, TraceHitColor,
+                               DrawDebugType, DrawTime);
+    }
+#endif
+    return OutHits.Num() > 0;
+}
+
+bool UGeneralUtilityBPLibrary::ConeVisionProfileByChannel(UObject *WorldContextObject,
+                                                          const UGeneralUtilityVisionProfile *Profile,
+                                                          FVector Location, FRotator ViewRotation,
+                                                          ETraceTypeQuery TraceChannel, bool bTraceComplex,
+                                                          const TArray<AActor *> &ActorsToIgnore,
+                                                          EDrawDebugTrace::Type DrawDebugType,
+                                                          TArray<FGeneralUtilityVisionHit> &OutHits,
+                                                          bool bIgnoreSelf, FLinearColor ScanColor,
+                                                          FLinearColor TraceHitColor, float DrawTime) {
+    OutHits.Reset();
+    if (Profile == nullptr) {
+        return false;
+    }
+
+    const FCollisionQueryParams params = ConfigureConeQueryParams(bTraceComplex, ActorsToIgnore, bIgnoreSelf,
+                                                                  WorldContextObject);
+    OverlapIntoVisionProfile(WorldContextObject, *Profile, Location, ViewRotation,
+                             [&](UWorld *world, TArray<FOverlapResult> &overlaps, const FVector &center,
+                                 const FQuat &rotation, const FCollisionShape &shape) {
+                                 world->OverlapMultiByChannel(overlaps, center, rotation,
+                                                              UEngineTypes::ConvertToCollisionChannel(TraceChannel),
+                                                              shape, params);
+                             }, OutHits);
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        DrawDebugVisionProfile(World, *Profile, Location, ViewRotation, OutHits, ScanColor, TraceHitColor,
+                               DrawDebugType, DrawTime);
+    }
+#endif
+    return OutHits.Num() > 0;
+}
+
+bool UGeneralUtilityBPLibrary::VisitConeOverlapsForObject(UObject *WorldContextObject, const FVector &Location,
+                                                          const FRotator &ViewRotation, float Distance,
+                                                          float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                          const FCollisionObjectQueryParams &ObjectParams,
+                                                          const FCollisionQueryParams &Params,
+                                                          FGeneralUtilityConeVisitor Visitor, bool bTestAnyFirst) {
+    if (!ObjectParams.IsValid()) {
+        return false;
+    }
+
+    return VisitOverlapsInCone(WorldContextObject,
+                               FGeneralUtilityConeWindow(Location, ViewRotation, HorizontalFieldOfView,
+                                                         VerticalFieldOfView), Distance, bTestAnyFirst,
+                               [&](UWorld *world, const FVector &center, const FQuat &rotation,
+                                   const FCollisionShape &shape) {
+                                   return world->OverlapAnyTestByObjectType(center, rotation, ObjectParams, shape,
+                                                                            Params);
+                               },
+                               [&](UWorld *world, TArray<FOverlapResult> &overlaps, const FVector &center,
+                                   const FQuat &rotation, const FCollisionShape &shape) {
+                                   world->OverlapMultiByObjectType(overlaps, center, rotation, ObjectParams, shape,
+                                                                   Params);
+                               }, Visitor);
+}
+
+bool UGeneralUtilityBPLibrary::VisitConeOverlapsByProfile(UObject *WorldContextObject, const FVector &Location,
+                                                          const FRotator &ViewRotation, float Distance,
+                                                          float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                          FName ProfileName,
+                                                          const FCollisionQueryParams &Params,
+                                                          FGeneralUtilityConeVisitor Visitor, bool bTestAnyFirst) {
+    return VisitOverlapsInCone(WorldContextObject,
+                               FGeneralUtilityConeWindow(Location, ViewRotation, HorizontalFieldOfView,
+                                                         VerticalFieldOfView), Distance, bTestAnyFirst,
+                               [&](UWorld *world, const FVector &center, const FQuat &rotation,
+                                   const FCollisionShape &shape) {
+                                   return world->OverlapAnyTestByProfile(center, rotation, ProfileName, shape, Params);
+                               },
+                               [&](UWorld *world, TArray<FOverlapResult> &overlaps, const FVector &center,
+                                   const FQuat &rotation, const FCollisionShape &shape) {
+                                   world->OverlapMultiByProfile(overlaps, center, rotation, ProfileName, shape, Params);
+                               }, Visitor);
+}
+
+bool UGeneralUtilityBPLibrary::VisitConeOverlapsByChannel(UObject *WorldContextObject, const FVector &Location,
+                                                          const FRotator &ViewRotation, float Distance,
+                                                          float HorizontalFieldOfView, float VerticalFieldOfView,
+                                                          ECollisionChannel TraceChannel,
+                                                          const FCollisionQueryParams &Params,
+                                                          FGeneralUtilityConeVisitor Visitor, bool bTestAnyFirst) {
+    return VisitOverlapsInCone(WorldContextObject,
+                               FGeneralUtilityConeWindow(Location, ViewRotation, HorizontalFieldOfView,
+                                                         VerticalFieldOfView), Distance, bTestAnyFirst,
+                               [&](UWorld *world, const FVector &center, const FQuat &rotation,
+                                   const FCollisionShape &shape) {
+                                   return world->OverlapAnyTestByChannel(center, rotation, TraceChannel, shape, Params);
+                               },
+                               [&](UWorld *world, TArray<FOverlapResult> &overlaps, const FVector &center,
+                                   const FQuat &rotation, const FCollisionShape &shape) {
+                                   world->OverlapMultiByChannel(overlaps, center, rotation, TraceChannel, shape,
+                                                                Params);
+                               }, Visitor);
+}
+
+bool UGeneralUtilityBPLibrary::ComputeMutualVisibility(UObject *WorldContextObject, const TArray<FTransform> &Agents,
+                                                       const TArray<FGeneralUtilityViewCone> &ViewCones,
+                                                       bool bTestLineOfSight, ETraceTypeQuery TraceChannel,
+                                                       const TArray<AActor *> &ActorsToIgnore,
+                                                       FGeneralUtilityVisibilityMatrix &OutMatrix) {
+    int32 agentCount = Agents.Num();
+    OutMatrix.Reset(agentCount);
+
+    if (agentCount < 2 || ViewCones.Num() == 0) {
+        return false;
+    }
+
+    TArray<FGeneralUtilityConeTest> tests;
+    tests.Reserve(agentCount);
+    float cellSize = 0.f;
+
+    for (int32 i = 0; i < agentCount; i++) {
+        const FGeneralUtilityViewCone &cone = ViewCones[FMath::Min(i, ViewCones.Num() - 1)];
+        tests.Emplace(FGeneralUtilityConeWindow(Agents[i].GetLocation(), Agents[i].Rotator(),
+                                                cone.HorizontalFieldOfView, cone.VerticalFieldOfView),
+                      cone.Distance);
+        cellSize = FMath::Max(cellSize, cone.Distance);
+    }
+
+    if (cellSize <= 0.f) {
+        return false;
+    }
+
+    // Cells smaller than a unit would put world coordinates outside the range the cell keys can hold
+    cellSize = FMath::Max(cellSize, 1.f);
+
+    // No agent sees further than a cell, so only agents in neighbouring cells can see each other
+    TArray<FIntVector> agentCells;
+    TArray<TPair<uint64, int32> > cells;
+    agentCells.Reserve(agentCount);
+    cells.Reserve(agentCount);
+
+    for (int32 i = 0; i < agentCount; i++) {
+        const FVector scaled = tests[i].Location / cellSize;
+        agentCells.Emplace(FMath::FloorToInt(scaled.X), FMath::FloorToInt(scaled.Y), FMath::FloorToInt(scaled.Z));
+        cells.Emplace(GetGridCellKey(agentCells[i]), i);
+    }
+    cells.Sort([](const TPair<uint64, int32> &A, const TPair<uint64, int32> &B) {
+        return A.Key < B.Key;
+    });
+
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    ECollisionChannel channel = UEngineTypes::ConvertToCollisionChannel(TraceChannel);
+    FCollisionQueryParams params(SCENE_QUERY_STAT(ComputeMutualVisibility), false);
+    params.AddIgnoredActors(ActorsToIgnore);
+
+    bool anyVisible = false;
+
+    for (int32 i = 0; i < agentCount; i++) {
+        for (int32 x = -1; x <= 1; x++) {
+            for (int32 y = -1; y <= 1; y++) {
+                for (int32 z = -1; z <= 1; z++) {
+                    uint64 key = GetGridCellKey(agentCells[i] + FIntVector(x, y, z));
+                    int32 first = Algo::LowerBoundBy(cells, key, [](const TPair<uint64, int32> &Cell) {
+                        return Cell.Key;
+                    });
+
+                    for (int32 k = first; k < cells.Num() && cells[k].Key == key; k++) {
+                        // Each pair is handled once, from its lower index
+                        int32 j = cells[k].Value;
+                        if (j <= i) {
+                            continue;
+                        }
+
+                        bool iSeesJ = tests[i].Contains(tests[j].Location);
+                        bool jSeesI = tests[j].Contains(tests[i].Location);
+                        if (!iSeesJ && !jSeesI) {
+                            continue;
+                        }
+
+                        if (bTestLineOfSight && World != nullptr
+                            && World->LineTraceTestByChannel(tests[i].Location, tests[j].Location, channel, params)) {
+                            continue;
+                        }
+
+                        if (iSeesJ) {
+                            OutMatrix.Set(i, j);
+                        }
+                        if (jSeesI) {
+                            OutMatrix.Set(j, i);
+                        }
+                        anyVisible = true;
+                    }
+                }
+            }
+        }
+    }
+    return anyVisible;
+}
+
 void UGeneralUtilityBPLibrary::FilterItemsIntoCone(UObject *WorldContextObject, FVector Location, float LeftAngle,
                                                    float RightAngle,
                                                    float TopAngle, float BottomAngle, TArray<FHitResult> &OutHits,
@@ -430,6 +1699,67 @@ void UGeneralUtilityBPLibrary::FilterItemsIntoCone(UObject *WorldContextObject,
     });
 }
 
+void UGeneralUtilityBPLibrary::FilterItemsIntoSweptCone(UObject *WorldContextObject, const FTransform &StartTransform,
+                                                        const FTransform &EndTransform, float HorizontalFieldOfView,
+                                                        float VerticalFieldOfView, TArray<FHitResult> &OutHits,
+                                                        EDrawDebugTrace::Type DrawDebugType,
+                                                        FLinearColor ActorColor,
+                                                        FLinearColor TraceHitColor,
+                                                        float DrawTime) {
+
+#if ENABLE_DRAW_DEBUG
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+#endif
+
+    const FVector startLocation = StartTransform.GetLocation();
+    const FVector endLocation = EndTransform.GetLocation();
+    const FRotator startRotation = StartTransform.Rotator();
+    const FRotator endRotation = EndTransform.Rotator();
+
+    // Most targets are already within the view at either end of the motion, so those skip the interval test
+    const FGeneralUtilityConeWindow startWindow(startLocation, startRotation, HorizontalFieldOfView,
+                                                VerticalFieldOfView);
+    const FGeneralUtilityConeWindow endWindow(endLocation, endRotation, HorizontalFieldOfView, VerticalFieldOfView);
+
+    OutHits.RemoveAll([&](auto &hit) {
+        if (hit.GetActor() != nullptr) {
+            AActor *actor = hit.GetActor();
+            const FVector actorLocation = actor->GetActorLocation();
+
+            bool isHit = startWindow.Contains(actorLocation) || endWindow.Contains(actorLocation)
+                         || IsInSweptCone(actorLocation, startLocation, endLocation, startRotation, endRotation,
+                                          startWindow.HalfHorizontalFieldOfView,
+                                          startWindow.HalfVerticalFieldOfView);
+
+#if ENABLE_DRAW_DEBUG
+            if (DrawDebugType != EDrawDebugTrace::None) {
+                ::DrawDebugLine(World, startLocation, actor->GetActorLocation(),
+                                (isHit ? TraceHitColor : ActorColor).ToFColor(true),
+                                DrawDebugType == EDrawDebugTrace::Persistent,
+                                DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f);
+                ::DrawDebugPoint(World, actor->GetActorLocation(), 5,
+                                 (isHit ? TraceHitColor : ActorColor).ToFColor(true),
+                                 DrawDebugType == EDrawDebugTrace::Persistent,
+                                 DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f);
+            }
+#endif
+            return !isHit;
+        }
+        return true;
+    });
+}
+
+bool UGeneralUtilityBPLibrary::GetConeOccupancyBin(const FGeneralUtilityConeOccupancyGrid &Grid, FVector Point,
+                                                   FGeneralUtilityConeOccupancyBin &OutBin) {
+    int32 index = Grid.GetBinIndex(Point);
+    if (index == INDEX_NONE) {
+        return false;
+    }
+
+    OutBin = Grid.Bins[index];
+    return true;
+}
+
 
 void UGeneralUtilityBPLibrary::DrawDebugCameraComponent(const UCameraComponent *CameraActor, FLinearColor CameraColor,
                                                         float Duration) {
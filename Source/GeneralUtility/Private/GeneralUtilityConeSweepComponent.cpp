@@ -0,0 +1,102 @@
+#include "GeneralUtilityConeSweepComponent.h"
+#include <DrawDebugHelpers.h>
+#include <Engine/World.h>
+#include "GeneralUtilityConeMath.h"
+
+UGeneralUtilityConeSweepComponent::UGeneralUtilityConeSweepComponent()
+        : Distance(3000.f), HorizontalFieldOfView(360.f), VerticalFieldOfView(60.f), SectorCount(12),
+          SectorsPerUpdate(1), TraceChannel(TraceTypeQuery1), bTraceComplex(false), DrawDebugType(EDrawDebugTrace::None),
+          DrawTime(5.f), NextSector(0) {
+    PrimaryComponentTick.bCanEverTick = true;
+}
+
+void UGeneralUtilityConeSweepComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
+                                                      FActorComponentTickFunction *ThisTickFunction) {
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    int32 sectorCount = FMath::Max(SectorCount, 1);
+    if (Sectors.Num() != sectorCount) {
+        Sectors.SetNum(sectorCount);
+        NextSector = 0;
+    }
+
+    int32 updates = FMath::Min(FMath::Max(SectorsPerUpdate, 1), sectorCount);
+    for (int32 i = 0; i < updates; i++) {
+        UpdateSector(NextSector);
+        NextSector = (NextSector + 1) % sectorCount;
+    }
+}
+
+void UGeneralUtilityConeSweepComponent::UpdateSector(int32 SectorIndex) {
+    const FTransform &transform = GetComponentTransform();
+    const FRotator rotation = transform.Rotator();
+
+    float sectorWidth = HorizontalFieldOfView / Sectors.Num();
+    FRotator sectorRotation(rotation.Pitch,
+                            rotation.Yaw - HorizontalFieldOfView / 2.f + (SectorIndex + 0.5f) * sectorWidth, 0.f);
+
+    const FGeneralUtilityConeWindow window(transform.GetLocation(), sectorRotation, sectorWidth, VerticalFieldOfView);
+    TArray<FHitResult> &hits = Sectors[SectorIndex];
+    hits.Reset();
+
+    FVector center;
+    FVector halfSize;
+    FRotator orientation;
+    ETraceTypeQuery traceType = TraceChannel;
+
+    if (window.GetSliceBox(0.f, Distance, center, halfSize, orientation)) {
+        UKismetSystemLibrary::BoxTraceMulti(this, center, center, halfSize, orientation, traceType, bTraceComplex,
+                                            TArray<AActor *>(), DrawDebugType, hits, true, FLinearColor::Red,
+                                            FLinearColor::Green, DrawTime);
+    } else {
+        UKismetSystemLibrary::SphereTraceMulti(this, window.Location, window.Location, Distance, traceType,
+                                               bTraceComplex, TArray<AActor *>(), DrawDebugType, hits, true,
+                                               FLinearColor::Red, FLinearColor::Green, DrawTime);
+    }
+
+    const float distanceSquared = FMath::Square(Distance);
+    hits.RemoveAll([&](const FHitResult &hit) {
+        const AActor *actor = hit.GetActor();
+        return actor == nullptr
+               || FVector::DistSquared(window.Location, actor->GetActorLocation()) > distanceSquared
+               || !window.Contains(actor->GetActorLocation());
+    });
+
+#if ENABLE_DRAW_DEBUG
+    if (DrawDebugType != EDrawDebugTrace::None) {
+        ::DrawDebugAltCone(GetWorld(), window.Location, sectorRotation, Distance,
+                           FMath::DegreesToRadians(sectorWidth), FMath::DegreesToRadians(VerticalFieldOfView),
+                           FColor::Yellow, DrawDebugType == EDrawDebugTrace::Persistent,
+                           DrawDebugType == EDrawDebugTrace::ForDuration ? DrawTime : 0.f);
+    }
+#endif
+}
+
+bool UGeneralUtilityConeSweepComponent::GetHits(TArray<FHitResult> &OutHits) const {
+    OutHits.Reset();
+    TSet<const AActor *> gathered;
+
+    // Newest sectors first, so a moving actor is reported where it was last seen
+    for (int32 i = 1; i <= Sectors.Num(); i++) {
+        const TArray<FHitResult> &hits = Sectors[(NextSector - i + Sectors.Num()) % Sectors.Num()];
+
+        for (const FHitResult &hit : hits) {
+            // Actors destroyed since their sector was queried are dropped
+            if (hit.GetActor() == nullptr) {
+                continue;
+            }
+
+            bool alreadyGathered = false;
+            gathered.Add(hit.GetActor(), &alreadyGathered);
+            if (!alreadyGathered) {
+                OutHits.Add(hit);
+            }
+        }
+    }
+    return OutHits.Num() > 0;
+}
+
+void UGeneralUtilityConeSweepComponent::ResetSweep() {
+    Sectors.Reset();
+    NextSector = 0;
+}
@@ -0,0 +1,212 @@
+#include "GeneralUtilityStaticTargetIndex.h"
+#include <EngineUtils.h>
+#include <Engine/Engine.h>
+#include <Serialization/CustomVersion.h>
+#include "GeneralUtilityConeMath.h"
+
+#if WITH_EDITOR
+#include <Editor.h>
+#include <ScopedTransaction.h>
+#endif
+
+/**
+ * Versions of the index's bulk serialized data, add an entry before VersionPlusOne whenever its layout changes
+ */
+struct FGeneralUtilityStaticTargetIndexVersion {
+    enum Type {
+        Initial = 0,
+
+        VersionPlusOne,
+        LatestVersion = VersionPlusOne - 1
+    };
+
+    static const FGuid GUID;
+};
+
+const FGuid FGeneralUtilityStaticTargetIndexVersion::GUID(0xFC821EEE, 0x2BB44602, 0x80C17EC4, 0x102E3C25);
+
+static FCustomVersionRegistration GRegisterGeneralUtilityStaticTargetIndexVersion(
+        FGeneralUtilityStaticTargetIndexVersion::GUID, FGeneralUtilityStaticTargetIndexVersion::LatestVersion,
+        TEXT("GeneralUtilityStaticTargetIndex"));
+
+namespace {
+    /** How many children each inner node of the hierarchy has */
+    constexpr int32 NodeFanOut = 8;
+
+#if WITH_EDITOR
+
+    /** Spreads the lower 10 bits of a value out so there are two zero bits between each */
+    uint32 ExpandBits(uint32 Value) {
+        Value = (Value * 0x00010001u) & 0xFF0000FFu;
+        Value = (Value * 0x00000101u) & 0x0F00F00Fu;
+        Value = (Value * 0x00000011u) & 0xC30C30C3u;
+        Value = (Value * 0x00000005u) & 0x49249249u;
+        return Value;
+    }
+
+    /** Interleaves the location quantized to 10 bits per axis within the bounds */
+    uint32 GetMortonCode(const FVector &Location, const FBox &Bounds) {
+        FVector normalized = (Location - Bounds.Min) / Bounds.GetSize().ComponentMax(FVector(KINDA_SMALL_NUMBER));
+        uint32 x = FMath::Clamp(FMath::FloorToInt(normalized.X * 1023.f), 0, 1023);
+        uint32 y = FMath::Clamp(FMath::FloorToInt(normalized.Y * 1023.f), 0, 1023);
+        uint32 z = FMath::Clamp(FMath::FloorToInt(normalized.Z * 1023.f), 0, 1023);
+        return (ExpandBits(x) << 2) | (ExpandBits(y) << 1) | ExpandBits(z);
+    }
+
+#endif
+}
+
+void UGeneralUtilityStaticTargetIndex::Serialize(FArchive &Ar) {
+    Ar.UsingCustomVersion(FGeneralUtilityStaticTargetIndexVersion::GUID);
+    Super::Serialize(Ar);
+
+    Targets.BulkSerialize(Ar);
+    Nodes.BulkSerialize(Ar);
+    Ar << LeafCount;
+}
+
+int32 UGeneralUtilityStaticTargetIndex::QueryCone(const FVector &Location, const FRotator &ViewRotation,
+                                                  float Distance, float HorizontalFieldOfView,
+                                                  float VerticalFieldOfView,
+                                                  TArray<FGeneralUtilityStaticTargetHit> &OutHits) const {
+    if (Nodes.Num() == 0) {
+        return 0;
+    }
+
+    const FGeneralUtilityConeWindow window(Location, ViewRotation, HorizontalFieldOfView, VerticalFieldOfView);
+    const float distanceSquared = FMath::Square(Distance);
+    int32 found = 0;
+
+    TArray<int32, TInlineAllocator<64> > stack;
+    stack.Add(Nodes.Num() - 1);
+
+    while (stack.Num() > 0) {
+        int32 nodeIndex = stack.Pop(false);
+        const FGeneralUtilityStaticTargetNode &node = Nodes[nodeIndex];
+
+        if (!FMath::SphereAABBIntersection(Location, distanceSquared, FBox(node.Min, node.Max))) {
+            continue;
+        }
+
+        if (nodeIndex >= LeafCount) {
+            for (int32 i = node.First; i < node.First + node.Count; i++) {
+                stack.Add(i);
+            }
+            continue;
+        }
+
+        for (int32 i = node.First; i < node.First + node.Count; i++) {
+            const FGeneralUtilityStaticTarget &target = Targets[i];
+            float targetDistanceSquared = FVector::DistSquared(Location, target.Location);
+
+            if (targetDistanceSquared <= distanceSquared && window.Contains(target.Location)) {
+                FGeneralUtilityStaticTargetHit &hit = OutHits.AddDefaulted_GetRef();
+                hit.Index = i;
+                hit.Location = target.Location;
+                hit.Tag = Tags.IsValidIndex(target.TagIndex) ? Tags[target.TagIndex] : NAME_None;
+                hit.Distance = FMath::Sqrt(targetDistanceSquared);
+                found++;
+            }
+        }
+    }
+    return found;
+}
+
+#if WITH_EDITOR
+
+void UGeneralUtilityStaticTargetIndex::BakeFromWorld(UObject *WorldContextObject) {
+    UWorld *World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    if (World == nullptr) {
+        return;
+    }
+
+    Modify();
+
+    Targets.Reset();
+    Nodes.Reset();
+    Tags.Reset();
+    LeafCount = 0;
+
+    FBox bounds(ForceInit);
+
+    for (TActorIterator<AActor> it(World); it; ++it) {
+        AActor *actor = *it;
+        USceneComponent *root = actor->GetRootComponent();
+        if (root == nullptr || root->Mobility != EComponentMobility::Static) {
+            continue;
+        }
+
+        bool matches = !TargetTag.IsNone() && actor->ActorHasTag(TargetTag);
+        for (const TSubclassOf<AActor> &targetClass : TargetClasses) {
+            matches |= targetClass != nullptr && actor->IsA(targetClass);
+        }
+
+        if (matches) {
+            FGeneralUtilityStaticTarget &target = Targets.AddDefaulted_GetRef();
+            target.Location = actor->GetActorLocation();
+            target.TagIndex = Tags.AddUnique(actor->Tags.Num() > 0 ? actor->Tags[0] : NAME_None);
+            bounds += target.Location;
+        }
+    }
+
+    TArray<TPair<uint32, FGeneralUtilityStaticTarget> > ordered;
+    ordered.Reserve(Targets.Num());
+    for (const FGeneralUtilityStaticTarget &target : Targets) {
+        ordered.Emplace(GetMortonCode(target.Location, bounds), target);
+    }
+    ordered.Sort([](const TPair<uint32, FGeneralUtilityStaticTarget> &A,
+                    const TPair<uint32, FGeneralUtilityStaticTarget> &B) {
+        return A.Key < B.Key;
+    });
+    for (int32 i = 0; i < ordered.Num(); i++) {
+        Targets[i] = ordered[i].Value;
+    }
+
+    int32 leafSize = FMath::Max(LeafSize, 1);
+    for (int32 first = 0; first < Targets.Num(); first += leafSize) {
+        FGeneralUtilityStaticTargetNode node;
+        node.First = first;
+        node.Count = FMath::Min(leafSize, Targets.Num() - first);
+
+        FBox box(ForceInit);
+        for (int32 i = node.First; i < node.First + node.Count; i++) {
+            box += Targets[i].Location;
+        }
+        node.Min = box.Min;
+        node.Max = box.Max;
+        Nodes.Add(node);
+    }
+    LeafCount = Nodes.Num();
+
+    int32 levelStart = 0;
+    while (Nodes.Num() - levelStart > 1) {
+        int32 levelEnd = Nodes.Num();
+
+        for (int32 first = levelStart; first < levelEnd; first += NodeFanOut) {
+            FGeneralUtilityStaticTargetNode node;
+            node.First = first;
+            node.Count = FMath::Min(NodeFanOut, levelEnd - first);
+
+            FBox box(ForceInit);
+            for (int32 i = node.First; i < node.First + node.Count; i++) {
+                box += FBox(Nodes[i].Min, Nodes[i].Max);
+            }
+            node.Min = box.Min;
+            node.Max = box.Max;
+            Nodes.Add(node);
+        }
+        levelStart = levelEnd;
+    }
+
+    MarkPackageDirty();
+}
+
+void UGeneralUtilityStaticTargetIndex::BakeFromEditorWorld() {
+    if (GEditor != nullptr) {
+        const FScopedTransaction transaction(NSLOCTEXT("GeneralUtility", "BakeStaticTargetIndex",
+                                                       "Bake Static Target Index"));
+        BakeFromWorld(GEditor->GetEditorWorldContext().World());
+    }
+}
+
+#endif
@@ -0,0 +1,9 @@
+#include "GeneralUtilityVisionProfile.h"
+
+float UGeneralUtilityVisionProfile::GetMaxDistance() const {
+    float maxDistance = 0.f;
+    for (const FGeneralUtilityVisionRegion &region : Regions) {
+        maxDistance = FMath::Max(maxDistance, region.Distance);
+    }
+    return maxDistance;
+}
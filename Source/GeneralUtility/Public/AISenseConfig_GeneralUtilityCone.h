@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Engine/EngineTypes.h>
+#include <Perception/AISenseConfig.h>
+#include <Perception/AIPerceptionTypes.h>
+#include "AISense_GeneralUtilityCone.h"
+#include "AISenseConfig_GeneralUtilityCone.generated.h"
+
+/**
+ * Configures a perception component's use of {@link UAISense_GeneralUtilityCone}
+ */
+UCLASS(meta = (DisplayName = "AI General Utility Cone config"))
+class GENERALUTILITY_API UAISenseConfig_GeneralUtilityCone : public UAISenseConfig {
+    GENERATED_BODY()
+public:
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Sense", NoClear, config)
+    TSubclassOf<UAISense_GeneralUtilityCone> Implementation;
+
+    /** This distance from the listener in its view direction that should be queried */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sense", config, meta = (UIMin = 0.0, ClampMin = 0.0))
+    float Distance;
+
+    /** The horizontal angle that actors should be perceived within */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sense", config, meta = (UIMin = 0.0, ClampMin = 0.0, UIMax = 360.0, ClampMax = 360.0))
+    float HorizontalFieldOfView;
+
+    /** The vertical angle that actors should be perceived within */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sense", config, meta = (UIMin = 0.0, ClampMin = 0.0, UIMax = 180.0, ClampMax = 180.0))
+    float VerticalFieldOfView;
+
+    /** Object types the cone query finds */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sense", config)
+    TArray<TEnumAsByte<EObjectTypeQuery> > ObjectTypes;
+
+    /** True to test against complex collision, false to test against simplified collision */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sense", config)
+    bool bTraceComplex;
+
+    /** True to only perceive actors with nothing blocking the line from the listener to them */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sense", config)
+    bool bTestLineOfSight;
+
+    /** Channel the line of sight is traced on */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sense", config, meta = (EditCondition = "bTestLineOfSight"))
+    TEnumAsByte<ECollisionChannel> LineOfSightChannel;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sense", config)
+    FAISenseAffiliationFilter DetectionByAffiliation;
+
+    UAISenseConfig_GeneralUtilityCone(const FObjectInitializer &ObjectInitializer = FObjectInitializer::Get());
+
+    virtual TSubclassOf<UAISense> GetSenseImplementation() const override;
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Perception/AISense.h>
+#include "AISense_GeneralUtilityCone.generated.h"
+
+class UAISenseConfig_GeneralUtilityCone;
+
+/**
+ * Sight like sense that finds its stimuli with the plugin's cone queries instead of per target line traces, allowing
+ * different horizontal and vertical fields of view. Listeners are served round robin so only a fixed number of cone
+ * queries are made each update. Occlusion is only tested when the config asks for line of sight, with a single trace
+ * to each actor found in the cone
+ */
+UCLASS(ClassGroup = AI, config = Game)
+class GENERALUTILITY_API UAISense_GeneralUtilityCone : public UAISense {
+    GENERATED_BODY()
+public:
+
+    /** How many listeners get a cone query per update, the rest are picked up in the following updates */
+    UPROPERTY(config, EditDefaultsOnly, Category = "AI Perception")
+    int32 MaxQueriesPerUpdate;
+
+    UAISense_GeneralUtilityCone(const FObjectInitializer &ObjectInitializer = FObjectInitializer::Get());
+
+protected:
+
+    virtual float Update() override;
+
+    void OnNewListenerImpl(const FPerceptionListener &NewListener);
+
+    void OnListenerUpdateImpl(const FPerceptionListener &UpdatedListener);
+
+    void OnListenerRemovedImpl(const FPerceptionListener &RemovedListener);
+
+    /**
+     * Runs the cone query of a single listener, registering stimuli for actors entering and leaving the cone
+     */
+    void QueryListener(FPerceptionListener &Listener, const UAISenseConfig_GeneralUtilityCone &SenseConfig);
+
+    /** Listeners using this sense, in the order they are queried */
+    TArray<FPerceptionListenerID> QueryQueue;
+
+    /** Position in {@link QueryQueue} the next update starts from */
+    int32 NextQueryIndex;
+
+    /** Actors each listener perceived in its last query, used to report them as lost once they leave the cone */
+    TMap<FPerceptionListenerID, TSet<TWeakObjectPtr<AActor> > > PerceivedActors;
+};
@@ -4,8 +4,24 @@
 #include <Engine/EngineTypes.h>
 #include <Kismet/BlueprintFunctionLibrary.h>
 #include <Camera/CameraComponent.h>
+#include "GeneralUtilityTypes.h"
 #include "GeneralUtilityBPLibrary.generated.h"
 
+class UGeneralUtilityStaticTargetIndex;
+class UGeneralUtilityVisionProfile;
+struct FOverlapResult;
+
+/**
+ * What a {@link FGeneralUtilityConeVisitor} wants the query to do after visiting a target
+ */
+enum class EGeneralUtilityConeVisit : uint8 {
+    Continue,
+    Stop
+};
+
+/** Called by the native VisitConeOverlaps* queries for each overlap found within the cone */
+typedef TFunctionRef<EGeneralUtilityConeVisit(const FOverlapResult &Overlap)> FGeneralUtilityConeVisitor;
+
 UCLASS()
 class GENERALUTILITY_API UGeneralUtilityBPLibrary : public UBlueprintFunctionLibrary {
     GENERATED_BODY()
@@ -369,6 +385,773 @@ public:
                                FLinearColor ActorColor = FLinearColor::Blue, float DrawTime = 5.0f);
 
 
+/**
+ * Does an overlap along the path of a moving viewer and then limits returned items to those that were inside the
+ * cone at any point of the motion, writen to be similar to {@link ConeOverlapMultiForObject}.
+ * The viewer is assumed to move linearly between the two transforms, allowing fast viewers to be queried at a low
+ * fixed rate without targets slipping between samples. The path is found with an overlap of the capsule the view
+ * distance sweeps out rather than a trace, so blocking geometry the viewer starts in doesn't cut the results short
+ *
+ * @param WorldContextObject        World context
+ * @param StartTransform            Transform of the viewer (e.g. camera) at the start of the interval
+ * @param EndTransform              Transform of the viewer (e.g. camera) at the end of the interval
+ * @param Distance                  This distance from the viewer in the view direction that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param ObjectTypes               Array of Object Types to query
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHits                   A hit for each overlapping component of the actors that were in the cone, so an actor
+ *                                  can appear more than once, in no particular order
+ * @param bIgnoreSelf
+ * @param TraceColor                Debug colour of the swept capsule
+ * @param TraceHitColor             Debug colour of actors that were in the cone
+ * @param ScanColor                 Debug colour of the cones
+ * @param ActorColor                Debug colour of actors tested that were not in the cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "TraceColor,TraceHitColor,ScanColor,ActorColor,DrawTime", Keywords = "sweep"))
+
+    static bool
+    ConeSweptOverlapMultiForObject(UObject *WorldContextObject, const FTransform &StartTransform,
+                                   const FTransform &EndTransform, float Distance,
+                                   float HorizontalFieldOfView, float VerticalFieldOfView,
+                                   const TArray<TEnumAsByte<EObjectTypeQuery> > &ObjectTypes, bool bTraceComplex,
+                                   const TArray<AActor *> &ActorsToIgnore, EDrawDebugTrace::Type DrawDebugType,
+                                   TArray<FHitResult> &OutHits, bool bIgnoreSelf,
+                                   FLinearColor TraceColor = FLinearColor::Red,
+                                   FLinearColor TraceHitColor = FLinearColor::Green,
+                                   FLinearColor ScanColor = FLinearColor::Yellow,
+                                   FLinearColor ActorColor = FLinearColor::Blue, float DrawTime = 5.0f);
+
+/**
+ * Does an overlap along the path of a moving viewer and then limits returned items to those that were inside the
+ * cone at any point of the motion, writen to be similar to {@link ConeOverlapMultiByProfile}
+ *
+ * @param WorldContextObject        World context
+ * @param StartTransform            Transform of the viewer (e.g. camera) at the start of the interval
+ * @param EndTransform              Transform of the viewer (e.g. camera) at the end of the interval
+ * @param Distance                  This distance from the viewer in the view direction that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param ProfileName               The 'profile' used to determine which components to hit
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHits                   A hit for each overlapping component of the actors that were in the cone, so an actor
+ *                                  can appear more than once, in no particular order
+ * @param bIgnoreSelf
+ * @param TraceColor                Debug colour of the swept capsule
+ * @param TraceHitColor             Debug colour of actors that were in the cone
+ * @param ScanColor                 Debug colour of the cones
+ * @param ActorColor                Debug colour of actors tested that were not in the cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "TraceColor,TraceHitColor,ScanColor,ActorColor,DrawTime", Keywords = "sweep"))
+
+    static bool
+    ConeSweptOverlapMultiByProfile(UObject *WorldContextObject, const FTransform &StartTransform,
+                                   const FTransform &EndTransform, float Distance,
+                                   float HorizontalFieldOfView, float VerticalFieldOfView,
+                                   FName ProfileName, bool bTraceComplex, const TArray<AActor *> &ActorsToIgnore,
+                                   EDrawDebugTrace::Type DrawDebugType, TArray<FHitResult> &OutHits,
+                                   bool bIgnoreSelf,
+                                   FLinearColor TraceColor = FLinearColor::Red,
+                                   FLinearColor TraceHitColor = FLinearColor::Green,
+                                   FLinearColor ScanColor = FLinearColor::Yellow,
+                                   FLinearColor ActorColor = FLinearColor::Blue, float DrawTime = 5.0f);
+
+/**
+ * Does an overlap along the path of a moving viewer and then limits returned items to those that were inside the
+ * cone at any point of the motion, writen to be similar to {@link ConeOverlapMultiByChannel}
+ *
+ * @param WorldContextObject        World context
+ * @param StartTransform            Transform of the viewer (e.g. camera) at the start of the interval
+ * @param EndTransform              Transform of the viewer (e.g. camera) at the end of the interval
+ * @param Distance                  This distance from the viewer in the view direction that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param TraceChannel
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHits                   A hit for each overlapping component of the actors that were in the cone, so an actor
+ *                                  can appear more than once, in no particular order
+ * @param bIgnoreSelf
+ * @param TraceColor                Debug colour of the swept capsule
+ * @param TraceHitColor             Debug colour of actors that were in the cone
+ * @param ScanColor                 Debug colour of the cones
+ * @param ActorColor                Debug colour of actors tested that were not in the cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "TraceColor,TraceHitColor,ScanColor,ActorColor,DrawTime", Keywords = "sweep"))
+
+    static bool
+    ConeSweptOverlapMultiByChannel(UObject *WorldContextObject, const FTransform &StartTransform,
+                                   const FTransform &EndTransform, float Distance,
+                                   float HorizontalFieldOfView, float VerticalFieldOfView,
+                                   ETraceTypeQuery TraceChannel, bool bTraceComplex,
+                                   const TArray<AActor *> &ActorsToIgnore, EDrawDebugTrace::Type DrawDebugType,
+                                   TArray<FHitResult> &OutHits, bool bIgnoreSelf,
+                                   FLinearColor TraceColor = FLinearColor::Red,
+                                   FLinearColor TraceHitColor = FLinearColor::Green,
+                                   FLinearColor ScanColor = FLinearColor::Yellow,
+                                   FLinearColor ActorColor = FLinearColor::Blue, float DrawTime = 5.0f);
+
+/**
+ * Does a Sphere trace and bins the actors found inside the cone into a fixed resolution yaw x pitch grid instead of
+ * returning them, writen to be similar to {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ *
+ * @param WorldContextObject        World context
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param Distance                  This distance from the {@code Location} in the @{code ViewRotation}'s that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param YawBins                   How many bins the horizontal field of view is split into, at most 256
+ * @param PitchBins                 How many bins the vertical field of view is split into, at most 256
+ * @param ObjectTypes               Array of Object Types to trace
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param ClassFilter               Up to 32 classes, bit N of a bin's class mask is set if it holds an actor of the N'th class
+ * @param DrawDebugType
+ * @param OutGrid                   The grid to write into, its bins are reused between queries
+ * @param bIgnoreSelf
+ * @param TraceColor                Debug colour of {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ * @param TraceHitColor             Debug colour of {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ * @param ScanColor                 Debug colour of actor tested that was not in cone
+ * @param ActorColor                Debug colour of actor tested that was in cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if any bin is occupied, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore,ClassFilter", AdvancedDisplay = "TraceColor,TraceHitColor,ScanColor,ActorColor,DrawTime", Keywords = "sweep"))
+
+    static bool
+    ConeSphereOccupancyForObject(UObject *WorldContextObject, FVector Location, FRotator ViewRotation, float Distance,
+                                 float HorizontalFieldOfView, float VerticalFieldOfView,
+                                 UPARAM(meta = (ClampMin = 1, ClampMax = 256)) int32 YawBins,
+                                 UPARAM(meta = (ClampMin = 1, ClampMax = 256)) int32 PitchBins,
+                                 const TArray<TEnumAsByte<EObjectTypeQuery> > &ObjectTypes, bool bTraceComplex,
+                                 const TArray<AActor *> &ActorsToIgnore,
+                                 const TArray<TSubclassOf<AActor> > &ClassFilter, EDrawDebugTrace::Type DrawDebugType,
+                                 FGeneralUtilityConeOccupancyGrid &OutGrid, bool bIgnoreSelf,
+                                 FLinearColor TraceColor = FLinearColor::Red,
+                                 FLinearColor TraceHitColor = FLinearColor::Green,
+                                 FLinearColor ScanColor = FLinearColor::Yellow,
+                                 FLinearColor ActorColor = FLinearColor::Blue, float DrawTime = 5.0f);
+
+/**
+ * Does a Sphere trace and bins the actors found inside the cone into a fixed resolution yaw x pitch grid instead of
+ * returning them, writen to be similar to {@link UKismetSystemLibrary::SphereTraceMultiByProfile}
+ *
+ * @param WorldContextObject        World context
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param Distance                  This distance from the {@code Location} in the @{code ViewRotation}'s that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param YawBins                   How many bins the horizontal field of view is split into, at most 256
+ * @param PitchBins                 How many bins the vertical field of view is split into, at most 256
+ * @param ProfileName               The 'profile' used to determine which components to hit
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param ClassFilter               Up to 32 classes, bit N of a bin's class mask is set if it holds an actor of the N'th class
+ * @param DrawDebugType
+ * @param OutGrid                   The grid to write into, its bins are reused between queries
+ * @param bIgnoreSelf
+ * @param TraceColor                Debug colour of {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ * @param TraceHitColor             Debug colour of {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ * @param ScanColor                 Debug colour of actor tested that was not in cone
+ * @param ActorColor                Debug colour of actor tested that was in cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if any bin is occupied, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore,ClassFilter", AdvancedDisplay = "TraceColor,TraceHitColor,ScanColor,ActorColor,DrawTime", Keywords = "sweep"))
+
+    static bool
+    ConeSphereOccupancyByProfile(UObject *WorldContextObject, FVector Location, FRotator ViewRotation, float Distance,
+                                 float HorizontalFieldOfView, float VerticalFieldOfView,
+                                 UPARAM(meta = (ClampMin = 1, ClampMax = 256)) int32 YawBins,
+                                 UPARAM(meta = (ClampMin = 1, ClampMax = 256)) int32 PitchBins,
+                                 FName ProfileName, bool bTraceComplex, const TArray<AActor *> &ActorsToIgnore,
+                                 const TArray<TSubclassOf<AActor> > &ClassFilter, EDrawDebugTrace::Type DrawDebugType,
+                                 FGeneralUtilityConeOccupancyGrid &OutGrid, bool bIgnoreSelf,
+                                 FLinearColor TraceColor = FLinearColor::Red,
+                                 FLinearColor TraceHitColor = FLinearColor::Green,
+                                 FLinearColor ScanColor = FLinearColor::Yellow,
+                                 FLinearColor ActorColor = FLinearColor::Blue, float DrawTime = 5.0f);
+
+/**
+ * Does a Sphere trace and bins the actors found inside the cone into a fixed resolution yaw x pitch grid instead of
+ * returning them, writen to be similar to {@link UKismetSystemLibrary::SphereTraceMulti}
+ *
+ * @param WorldContextObject        World context
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param Distance                  This distance from the {@code Location} in the @{code ViewRotation}'s that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param YawBins                   How many bins the horizontal field of view is split into, at most 256
+ * @param PitchBins                 How many bins the vertical field of view is split into, at most 256
+ * @param TraceChannel
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param ClassFilter               Up to 32 classes, bit N of a bin's class mask is set if it holds an actor of the N'th class
+ * @param DrawDebugType
+ * @param OutGrid                   The grid to write into, its bins are reused between queries
+ * @param bIgnoreSelf
+ * @param TraceColor                Debug colour of {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ * @param TraceHitColor             Debug colour of {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ * @param ScanColor                 Debug colour of actor tested that was not in cone
+ * @param ActorColor                Debug colour of actor tested that was in cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if any bin is occupied, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore,ClassFilter", AdvancedDisplay = "TraceColor,TraceHitColor,ScanColor,ActorColor,DrawTime", Keywords = "sweep"))
+
+    static bool
+    ConeSphereOccupancyByChannel(UObject *WorldContextObject, FVector Location, FRotator ViewRotation, float Distance,
+                                 float HorizontalFieldOfView, float VerticalFieldOfView,
+                                 UPARAM(meta = (ClampMin = 1, ClampMax = 256)) int32 YawBins,
+                                 UPARAM(meta = (ClampMin = 1, ClampMax = 256)) int32 PitchBins,
+                                 ETraceTypeQuery TraceChannel, bool bTraceComplex,
+                                 const TArray<AActor *> &ActorsToIgnore,
+                                 const TArray<TSubclassOf<AActor> > &ClassFilter, EDrawDebugTrace::Type DrawDebugType,
+                                 FGeneralUtilityConeOccupancyGrid &OutGrid, bool bIgnoreSelf,
+                                 FLinearColor TraceColor = FLinearColor::Red,
+                                 FLinearColor TraceHitColor = FLinearColor::Green,
+                                 FLinearColor ScanColor = FLinearColor::Yellow,
+                                 FLinearColor ActorColor = FLinearColor::Blue, float DrawTime = 5.0f);
+
+/**
+ * Finds the baked static targets of a {@link UGeneralUtilityStaticTargetIndex} that lie within a cone, without touching
+ * the physics scene. Meant to be used alongside the Cone*Trace* functions, which then only need to find dynamic targets
+ *
+ * @param WorldContextObject        World context
+ * @param StaticTargets             The baked index to query
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param Distance                  This distance from the {@code Location} in the @{code ViewRotation}'s that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that targets should be found within
+ * @param VerticalFieldOfView       The vertical angle that targets should be found within
+ * @param DrawDebugType
+ * @param OutHits                   The targets found within the cone
+ * @param ScanColor                 Debug colour of the cone
+ * @param TraceHitColor             Debug colour of targets found in the cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (WorldContext = "WorldContextObject", AdvancedDisplay = "ScanColor,TraceHitColor,DrawTime"))
+
+    static bool
+    ConeQueryStaticTargets(UObject *WorldContextObject, const UGeneralUtilityStaticTargetIndex *StaticTargets,
+                           FVector Location, FRotator ViewRotation, float Distance,
+                           float HorizontalFieldOfView, float VerticalFieldOfView,
+                           EDrawDebugTrace::Type DrawDebugType, TArray<FGeneralUtilityStaticTargetHit> &OutHits,
+                           FLinearColor ScanColor = FLinearColor::Yellow,
+                           FLinearColor TraceHitColor = FLinearColor::Green, float DrawTime = 5.0f);
+
+/**
+ * Splits a cone into distance bands that are each found with their own broadphase volume and collision complexity,
+ * merging the results. Writen to be similar to {@link UKismetSystemLibrary::SphereTraceMultiForObjects}. Most of a
+ * cone's volume is far away, so handing the far bands to simple collision or the baked static targets saves the most
+ *
+ * @param WorldContextObject        World context
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param Bands                     The bands in order of distance, each starting where the previous one ended
+ * @param StaticTargets             Index used by bands that only query static targets, may be null if there are none
+ * @param ObjectTypes               Array of Object Types to trace
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHits                   The hits found by the traced bands, ordered by band
+ * @param OutStaticHits             The static targets found by the static target bands
+ * @param bIgnoreSelf
+ * @param TraceColor                Debug colour of {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ * @param TraceHitColor             Debug colour of {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ * @param ScanColor                 Debug colour of the bands
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "TraceColor,TraceHitColor,ScanColor,DrawTime", Keywords = "sweep"))
+
+    static bool
+    ConeBandedTraceMultiForObject(UObject *WorldContextObject, FVector Location, FRotator ViewRotation,
+                                  float HorizontalFieldOfView, float VerticalFieldOfView,
+                                  const TArray<FGeneralUtilityConeBand> &Bands,
+                                  const UGeneralUtilityStaticTargetIndex *StaticTargets,
+                                  const TArray<TEnumAsByte<EObjectTypeQuery> > &ObjectTypes,
+                                  const TArray<AActor *> &ActorsToIgnore, EDrawDebugTrace::Type DrawDebugType,
+                                  TArray<FHitResult> &OutHits, TArray<FGeneralUtilityStaticTargetHit> &OutStaticHits,
+                                  bool bIgnoreSelf,
+                                  FLinearColor TraceColor = FLinearColor::Red,
+                                  FLinearColor TraceHitColor = FLinearColor::Green,
+                                  FLinearColor ScanColor = FLinearColor::Yellow, float DrawTime = 5.0f);
+
+/**
+ * Splits a cone into distance bands that are each found with their own broadphase volume and collision complexity,
+ * merging the results. Writen to be similar to {@link UKismetSystemLibrary::SphereTraceMultiByProfile}
+ *
+ * @param WorldContextObject        World context
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param Bands                     The bands in order of distance, each starting where the previous one ended
+ * @param StaticTargets             Index used by bands that only query static targets, may be null if there are none
+ * @param ProfileName               The 'profile' used to determine which components to hit
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHits                   The hits found by the traced bands, ordered by band
+ * @param OutStaticHits             The static targets found by the static target bands
+ * @param bIgnoreSelf
+ * @param TraceColor                Debug colour of {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ * @param TraceHitColor             Debug colour of {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ * @param ScanColor                 Debug colour of the bands
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "TraceColor,TraceHitColor,ScanColor,DrawTime", Keywords = "sweep"))
+
+    static bool
+    ConeBandedTraceMultiByProfile(UObject *WorldContextObject, FVector Location, FRotator ViewRotation,
+                                  float HorizontalFieldOfView, float VerticalFieldOfView,
+                                  const TArray<FGeneralUtilityConeBand> &Bands,
+                                  const UGeneralUtilityStaticTargetIndex *StaticTargets,
+                                  FName ProfileName, const TArray<AActor *> &ActorsToIgnore,
+                                  EDrawDebugTrace::Type DrawDebugType,
+                                  TArray<FHitResult> &OutHits, TArray<FGeneralUtilityStaticTargetHit> &OutStaticHits,
+                                  bool bIgnoreSelf,
+                                  FLinearColor TraceColor = FLinearColor::Red,
+                                  FLinearColor TraceHitColor = FLinearColor::Green,
+                                  FLinearColor ScanColor = FLinearColor::Yellow, float DrawTime = 5.0f);
+
+/**
+ * Splits a cone into distance bands that are each found with their own broadphase volume and collision complexity,
+ * merging the results. Writen to be similar to {@link UKismetSystemLibrary::SphereTraceMulti}
+ *
+ * @param WorldContextObject        World context
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param Bands                     The bands in order of distance, each starting where the previous one ended
+ * @param StaticTargets             Index used by bands that only query static targets, may be null if there are none
+ * @param TraceChannel
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHits                   The hits found by the traced bands, ordered by band
+ * @param OutStaticHits             The static targets found by the static target bands
+ * @param bIgnoreSelf
+ * @param TraceColor                Debug colour of {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ * @param TraceHitColor             Debug colour of {@link UKismetSystemLibrary::SphereTraceMultiForObjects}
+ * @param ScanColor                 Debug colour of the bands
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "TraceColor,TraceHitColor,ScanColor,DrawTime", Keywords = "sweep"))
+
+    static bool
+    ConeBandedTraceMultiByChannel(UObject *WorldContextObject, FVector Location, FRotator ViewRotation,
+                                  float HorizontalFieldOfView, float VerticalFieldOfView,
+                                  const TArray<FGeneralUtilityConeBand> &Bands,
+                                  const UGeneralUtilityStaticTargetIndex *StaticTargets,
+                                  ETraceTypeQuery TraceChannel, const TArray<AActor *> &ActorsToIgnore,
+                                  EDrawDebugTrace::Type DrawDebugType,
+                                  TArray<FHitResult> &OutHits, TArray<FGeneralUtilityStaticTargetHit> &OutStaticHits,
+                                  bool bIgnoreSelf,
+                                  FLinearColor TraceColor = FLinearColor::Red,
+                                  FLinearColor TraceHitColor = FLinearColor::Green,
+                                  FLinearColor ScanColor = FLinearColor::Yellow, float DrawTime = 5.0f);
+
+/**
+ * Does an overlap and only builds hit results for the actors inside the cone, writen to be similar to
+ * {@link ConeSphereTraceMultiForObject}. The overlap uses the cone's bounding box, or its sphere when that is the
+ * tighter shape. Candidates outside the cone are rejected straight from the overlap results so no hit result is built
+ * or copied for them, which saves the most with wide cones. The hits have no impact data, their location is that of the
+ * actor
+ *
+ * @param WorldContextObject        World context
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param Distance                  This distance from the {@code Location} in the @{code ViewRotation}'s that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param ObjectTypes               Array of Object Types to query
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHits                   A list of the actors in the cone, in no particular order
+ * @param bIgnoreSelf
+ * @param ScanColor                 Debug colour of the cone
+ * @param TraceHitColor             Debug colour of actors found in the cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "ScanColor,TraceHitColor,DrawTime", Keywords = "overlap"))
+
+    static bool
+    ConeOverlapMultiForObject(UObject *WorldContextObject, FVector Location, FRotator ViewRotation,
+                              float Distance, float HorizontalFieldOfView, float VerticalFieldOfView,
+                              const TArray<TEnumAsByte<EObjectTypeQuery> > &ObjectTypes, bool bTraceComplex,
+                              const TArray<AActor *> &ActorsToIgnore, EDrawDebugTrace::Type DrawDebugType,
+                              TArray<FHitResult> &OutHits, bool bIgnoreSelf,
+                              FLinearColor ScanColor = FLinearColor::Yellow,
+                              FLinearColor TraceHitColor = FLinearColor::Green, float DrawTime = 5.0f);
+
+/**
+ * Does an overlap and only builds hit results for the actors inside the cone, writen to be similar to
+ * {@link ConeSphereTraceMultiByProfile}
+ *
+ * @param WorldContextObject        World context
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param Distance                  This distance from the {@code Location} in the @{code ViewRotation}'s that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param ProfileName               The 'profile' used to determine which components to hit
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHits                   A list of the actors in the cone, in no particular order
+ * @param bIgnoreSelf
+ * @param ScanColor                 Debug colour of the cone
+ * @param TraceHitColor             Debug colour of actors found in the cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "ScanColor,TraceHitColor,DrawTime", Keywords = "overlap"))
+
+    static bool
+    ConeOverlapMultiByProfile(UObject *WorldContextObject, FVector Location, FRotator ViewRotation,
+                              float Distance, float HorizontalFieldOfView, float VerticalFieldOfView,
+                              FName ProfileName, bool bTraceComplex, const TArray<AActor *> &ActorsToIgnore,
+                              EDrawDebugTrace::Type DrawDebugType, TArray<FHitResult> &OutHits,
+                              bool bIgnoreSelf,
+                              FLinearColor ScanColor = FLinearColor::Yellow,
+                              FLinearColor TraceHitColor = FLinearColor::Green, float DrawTime = 5.0f);
+
+/**
+ * Does an overlap and only builds hit results for the actors inside the cone, writen to be similar to
+ * {@link ConeSphereTraceMultiByChannel}
+ *
+ * @param WorldContextObject        World context
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param Distance                  This distance from the {@code Location} in the @{code ViewRotation}'s that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param TraceChannel
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHits                   A list of the actors in the cone, in no particular order
+ * @param bIgnoreSelf
+ * @param ScanColor                 Debug colour of the cone
+ * @param TraceHitColor             Debug colour of actors found in the cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "ScanColor,TraceHitColor,DrawTime", Keywords = "overlap"))
+
+    static bool
+    ConeOverlapMultiByChannel(UObject *WorldContextObject, FVector Location, FRotator ViewRotation,
+                              float Distance, float HorizontalFieldOfView, float VerticalFieldOfView,
+                              ETraceTypeQuery TraceChannel, bool bTraceComplex,
+                              const TArray<AActor *> &ActorsToIgnore, EDrawDebugTrace::Type DrawDebugType,
+                              TArray<FHitResult> &OutHits, bool bIgnoreSelf,
+                              FLinearColor ScanColor = FLinearColor::Yellow,
+                              FLinearColor TraceHitColor = FLinearColor::Green, float DrawTime = 5.0f);
+
+/**
+ * Checks if anything is within the cone, writen to be similar to {@link ConeOverlapMultiForObject}. The overlaps within the
+ * cone's bounds are all gathered, as the engine can't stop that part way, but the filtering stops at the first actor
+ * found in the cone and no hit results are built for the rest
+ *
+ * @param WorldContextObject        World context
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param Distance                  This distance from the {@code Location} in the @{code ViewRotation}'s that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param ObjectTypes               Array of Object Types to query
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHit                    The first actor found in the cone, not necessarily the nearest
+ * @param bIgnoreSelf
+ * @param ScanColor                 Debug colour of the cone
+ * @param TraceHitColor             Debug colour of the actor found in the cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if anything is in the cone, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "ScanColor,TraceHitColor,DrawTime", Keywords = "overlap"))
+
+    static bool
+    ConeTestAnyForObject(UObject *WorldContextObject, FVector Location, FRotator ViewRotation, float Distance,
+                         float HorizontalFieldOfView, float VerticalFieldOfView,
+                         const TArray<TEnumAsByte<EObjectTypeQuery> > &ObjectTypes, bool bTraceComplex,
+                         const TArray<AActor *> &ActorsToIgnore, EDrawDebugTrace::Type DrawDebugType,
+                         FHitResult &OutHit, bool bIgnoreSelf, FLinearColor ScanColor = FLinearColor::Yellow,
+                         FLinearColor TraceHitColor = FLinearColor::Green, float DrawTime = 5.0f);
+
+/**
+ * Checks if anything is within the cone, writen to be similar to {@link ConeOverlapMultiByProfile}. The overlaps within the
+ * cone's bounds are all gathered, as the engine can't stop that part way, but the filtering stops at the first actor
+ * found in the cone and no hit results are built for the rest
+ *
+ * @param WorldContextObject        World context
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param Distance                  This distance from the {@code Location} in the @{code ViewRotation}'s that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param ProfileName               The 'profile' used to determine which components to hit
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHit                    The first actor found in the cone, not necessarily the nearest
+ * @param bIgnoreSelf
+ * @param ScanColor                 Debug colour of the cone
+ * @param TraceHitColor             Debug colour of the actor found in the cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if anything is in the cone, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "ScanColor,TraceHitColor,DrawTime", Keywords = "overlap"))
+
+    static bool
+    ConeTestAnyByProfile(UObject *WorldContextObject, FVector Location, FRotator ViewRotation, float Distance,
+                         float HorizontalFieldOfView, float VerticalFieldOfView, FName ProfileName,
+                         bool bTraceComplex, const TArray<AActor *> &ActorsToIgnore,
+                         EDrawDebugTrace::Type DrawDebugType, FHitResult &OutHit, bool bIgnoreSelf,
+                         FLinearColor ScanColor = FLinearColor::Yellow,
+                         FLinearColor TraceHitColor = FLinearColor::Green, float DrawTime = 5.0f);
+
+/**
+ * Checks if anything is within the cone, writen to be similar to {@link ConeOverlapMultiByChannel}. The overlaps within the
+ * cone's bounds are all gathered, as the engine can't stop that part way, but the filtering stops at the first actor
+ * found in the cone and no hit results are built for the rest
+ *
+ * @param WorldContextObject        World context
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+ * @param Distance                  This distance from the {@code Location} in the @{code ViewRotation}'s that should be queried
+ * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+ * @param VerticalFieldOfView       The vertical angle that objects should be found within
+ * @param TraceChannel
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHit                    The first actor found in the cone, not necessarily the nearest
+ * @param bIgnoreSelf
+ * @param ScanColor                 Debug colour of the cone
+ * @param TraceHitColor             Debug colour of the actor found in the cone
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if anything is in the cone, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "ScanColor,TraceHitColor,DrawTime", Keywords = "overlap"))
+
+    static bool
+    ConeTestAnyByChannel(UObject *WorldContextObject, FVector Location, FRotator ViewRotation, float Distance,
+                         float HorizontalFieldOfView, float VerticalFieldOfView, ETraceTypeQuery TraceChannel,
+                         bool bTraceComplex, const TArray<AActor *> &ActorsToIgnore,
+                         EDrawDebugTrace::Type DrawDebugType, FHitResult &OutHit, bool bIgnoreSelf,
+                         FLinearColor ScanColor = FLinearColor::Yellow,
+                         FLinearColor TraceHitColor = FLinearColor::Green, float DrawTime = 5.0f);
+
+/**
+ * Finds the actors within any region of a vision profile, writen to be similar to {@link ConeOverlapMultiForObject}. The
+ * regions are queried with a single overlap covering all of them and every candidate is classified in one pass, so
+ * each actor is returned once along with the first region it is within
+ *
+ * @param WorldContextObject        World context
+ * @param Profile                   The regions to query
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the regions form (e.g. camera's forward rotation)
+ * @param ObjectTypes               Array of Object Types to query
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHits                   The actors found, each with the region it was classified into, in no particular order
+ * @param bIgnoreSelf
+ * @param ScanColor                 Debug colour of the regions
+ * @param TraceHitColor             Debug colour of actors found in the regions
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "ScanColor,TraceHitColor,DrawTime", Keywords = "overlap vision"))
+
+    static bool
+    ConeVisionProfileForObject(UObject *WorldContextObject, const UGeneralUtilityVisionProfile *Profile,
+                               FVector Location, FRotator ViewRotation,
+                               const TArray<TEnumAsByte<EObjectTypeQuery> > &ObjectTypes, bool bTraceComplex,
+                               const TArray<AActor *> &ActorsToIgnore, EDrawDebugTrace::Type DrawDebugType,
+                               TArray<FGeneralUtilityVisionHit> &OutHits, bool bIgnoreSelf,
+                               FLinearColor ScanColor = FLinearColor::Yellow,
+                               FLinearColor TraceHitColor = FLinearColor::Green, float DrawTime = 5.0f);
+
+/**
+ * Finds the actors within any region of a vision profile, writen to be similar to {@link ConeOverlapMultiByProfile}
+ *
+ * @param WorldContextObject        World context
+ * @param Profile                   The regions to query
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the regions form (e.g. camera's forward rotation)
+ * @param ProfileName               The 'profile' used to determine which components to hit
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHits                   The actors found, each with the region it was classified into, in no particular order
+ * @param bIgnoreSelf
+ * @param ScanColor                 Debug colour of the regions
+ * @param TraceHitColor             Debug colour of actors found in the regions
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "ScanColor,TraceHitColor,DrawTime", Keywords = "overlap vision"))
+
+    static bool
+    ConeVisionProfileByProfile(UObject *WorldContextObject, const UGeneralUtilityVisionProfile *Profile,
+                               FVector Location, FRotator ViewRotation,
+                               FName ProfileName, bool bTraceComplex,
+                               const TArray<AActor *> &ActorsToIgnore, EDrawDebugTrace::Type DrawDebugType,
+                               TArray<FGeneralUtilityVisionHit> &OutHits, bool bIgnoreSelf,
+                               FLinearColor ScanColor = FLinearColor::Yellow,
+                               FLinearColor TraceHitColor = FLinearColor::Green, float DrawTime = 5.0f);
+
+/**
+ * Finds the actors within any region of a vision profile, writen to be similar to {@link ConeOverlapMultiByChannel}
+ *
+ * @param WorldContextObject        World context
+ * @param Profile                   The regions to query
+ * @param Location                  Start location (e.g. camera)
+ * @param ViewRotation              Which angle the regions form (e.g. camera's forward rotation)
+ * @param TraceChannel
+ * @param bTraceComplex             True to test against complex collision, false to test against simplified collision.
+ * @param ActorsToIgnore
+ * @param DrawDebugType
+ * @param OutHits                   The actors found, each with the region it was classified into, in no particular order
+ * @param bIgnoreSelf
+ * @param ScanColor                 Debug colour of the regions
+ * @param TraceHitColor             Debug colour of actors found in the regions
+ * @param DrawTime                  How long the debug renders should stay active
+ * @return                          True if there was a hit, false otherwise.
+ */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (bIgnoreSelf = "true", WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore", AdvancedDisplay = "ScanColor,TraceHitColor,DrawTime", Keywords = "overlap vision"))
+
+    static bool
+    ConeVisionProfileByChannel(UObject *WorldContextObject, const UGeneralUtilityVisionProfile *Profile,
+                               FVector Location, FRotator ViewRotation,
+                               ETraceTypeQuery TraceChannel, bool bTraceComplex,
+                               const TArray<AActor *> &ActorsToIgnore, EDrawDebugTrace::Type DrawDebugType,
+                               TArray<FGeneralUtilityVisionHit> &OutHits, bool bIgnoreSelf,
+                               FLinearColor ScanColor = FLinearColor::Yellow,
+                               FLinearColor TraceHitColor = FLinearColor::Green, float DrawTime = 5.0f);
+
+    /**
+     * Native form of the cone overlaps, calls the visitor for each overlap whose actor is within the cone until it asks
+     * to stop. The overlap uses the cone's bounding box instead of the sphere when that is the tighter shape. Stopping
+     * ends the filtering but not the overlap itself, which always gathers everything within the bounds
+     *
+     * @param WorldContextObject        World context
+     * @param Location                  Start location (e.g. camera)
+     * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+     * @param Distance                  How far from the location should be queried
+     * @param HorizontalFieldOfView     The horizontal angle that objects should be found within
+     * @param VerticalFieldOfView       The vertical angle that objects should be found within
+     * @param ObjectParams              Object types to query
+     * @param Params                    Query params, e.g. the actors to ignore
+     * @param Visitor                   Called for each overlap in the cone, in no particular order
+     * @param bTestAnyFirst             True to first run an overlap test that stops at the first body found, skipping
+     *                                  the gather when the bounds are empty at the cost of an extra query when not
+     * @return                          True if the visitor was called at least once, false otherwise.
+     */
+    static bool
+    VisitConeOverlapsForObject(UObject *WorldContextObject, const FVector &Location, const FRotator &ViewRotation,
+                               float Distance, float HorizontalFieldOfView, float VerticalFieldOfView,
+                               const FCollisionObjectQueryParams &ObjectParams, const FCollisionQueryParams &Params,
+                               FGeneralUtilityConeVisitor Visitor, bool bTestAnyFirst = false);
+
+    /**
+     * Native form of the cone overlaps by profile, see {@link VisitConeOverlapsForObject}
+     */
+    static bool
+    VisitConeOverlapsByProfile(UObject *WorldContextObject, const FVector &Location, const FRotator &ViewRotation,
+                               float Distance, float HorizontalFieldOfView, float VerticalFieldOfView,
+                               FName ProfileName, const FCollisionQueryParams &Params,
+                               FGeneralUtilityConeVisitor Visitor, bool bTestAnyFirst = false);
+
+    /**
+     * Native form of the cone overlaps by channel, see {@link VisitConeOverlapsForObject}
+     */
+    static bool
+    VisitConeOverlapsByChannel(UObject *WorldContextObject, const FVector &Location, const FRotator &ViewRotation,
+                               float Distance, float HorizontalFieldOfView, float VerticalFieldOfView,
+                               ECollisionChannel TraceChannel, const FCollisionQueryParams &Params,
+                               FGeneralUtilityConeVisitor Visitor, bool bTestAnyFirst = false);
+
+    /**
+     * Works out which of a group of agents can see each other in a single pass. Agents are bucketed into a grid the
+     * size of the longest view distance so only nearby pairs are tested, and each pair shares one line of sight trace
+     *
+     * @param WorldContextObject    World context
+     * @param Agents                View transform of each agent (e.g. their cameras)
+     * @param ViewCones             View cone of each agent, agents past the end of the array use the last one
+     * @param bTestLineOfSight      True to also require nothing blocking the line between two agents
+     * @param TraceChannel          Channel the line of sight is traced on
+     * @param ActorsToIgnore        Actors the line of sight traces ignore, usually the agents themselves
+     * @param OutMatrix             Which agent can see which
+     * @return                      True if any agent can see another, false otherwise.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Collision",
+              meta = (WorldContext = "WorldContextObject", AutoCreateRefTerm = "ActorsToIgnore"))
+
+    static bool
+    ComputeMutualVisibility(UObject *WorldContextObject, const TArray<FTransform> &Agents,
+                            const TArray<FGeneralUtilityViewCone> &ViewCones, bool bTestLineOfSight,
+                            ETraceTypeQuery TraceChannel, const TArray<AActor *> &ActorsToIgnore,
+                            FGeneralUtilityVisibilityMatrix &OutMatrix);
+
+    /**
+     * Reads a visibility matrix
+     *
+     * @param Matrix                Matrix filled by {@link ComputeMutualVisibility}
+     * @param Viewer                Index of the agent looking
+     * @param Target                Index of the agent looked at
+     * @return                      True if the viewer can see the target, false otherwise.
+     */
+    UFUNCTION(BlueprintPure, Category = "Collision")
+
+    static bool
+    CanAgentSee(const FGeneralUtilityVisibilityMatrix &Matrix, int32 Viewer, int32 Target) {
+        return Matrix.Get(Viewer, Target);
+    }
+
     /**
      * Removes items not in the code from the supplied array
      *
@@ -393,6 +1176,46 @@ public:
                         EDrawDebugTrace::Type DrawDebugType, FLinearColor ActorColor = FLinearColor::Blue,
                         FLinearColor TraceHitColor = FLinearColor::Green, float DrawTime = 5.f);
 
+    /**
+     * Removes items that were not in the cone at any point while it moved linearly from the start to the end transform.
+     * The target's bearing from the moving viewer is bounded analytically and tested for overlap with the angular
+     * interval the view covered, so the result is conservative rather than sampled
+     *
+     * @param WorldContextObject    World context
+     * @param StartTransform        Transform of the viewer (e.g. camera) at the start of the interval
+     * @param EndTransform          Transform of the viewer (e.g. camera) at the end of the interval
+     * @param HorizontalFieldOfView The horizontal angle that objects should be found within
+     * @param VerticalFieldOfView   The vertical angle that objects should be found within
+     * @param OutHits               The list to have items removed from
+     * @param DrawDebugType
+     * @param ActorColor            Debug colour of actor tested that was not in cone
+     * @param TraceHitColor         Debug colour of actor tested that was in cone
+     * @param DrawTime              How long the debug renders should stay active
+     */
+    UFUNCTION(BlueprintCallable, Category = "Filtering",
+              meta = (WorldContext = "WorldContextObject", AdvancedDisplay = "ActorColor,TraceHitColor,DrawTime", Keywords = "sweep"))
+
+    static void
+    FilterItemsIntoSweptCone(UObject *WorldContextObject, const FTransform &StartTransform,
+                             const FTransform &EndTransform, float HorizontalFieldOfView, float VerticalFieldOfView,
+                             TArray<FHitResult> &OutHits, EDrawDebugTrace::Type DrawDebugType,
+                             FLinearColor ActorColor = FLinearColor::Blue,
+                             FLinearColor TraceHitColor = FLinearColor::Green, float DrawTime = 5.f);
+
+    /**
+     * Reads the bin of an occupancy grid covering the direction towards a point
+     *
+     * @param Grid                  Grid filled by one of the Cone*Occupancy* queries
+     * @param Point                 World location to look up
+     * @param OutBin                The bin covering the direction, left untouched if outside the cone
+     * @return                      True if the direction lies within the grid's cone, false otherwise.
+     */
+    UFUNCTION(BlueprintPure, Category = "Filtering")
+
+    static bool
+    GetConeOccupancyBin(const FGeneralUtilityConeOccupancyGrid &Grid, FVector Point,
+                        FGeneralUtilityConeOccupancyBin &OutBin);
+
 
     /**
      * Similar to {@link UKismetSystemLibrary::DrawDebugCamera} but uses a component instead of an actor
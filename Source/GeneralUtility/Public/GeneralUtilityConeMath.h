@@ -0,0 +1,152 @@
+#pragma once
+
+#include <CoreMinimal.h>
+
+/**
+ * Native description of the angular window of a view cone, used by the cone queries to test candidates.
+ * Unlike {@link UGeneralUtilityBPLibrary::FilterItemsIntoCone} the test is wrap safe around the +-180 yaw seam
+ */
+struct FGeneralUtilityConeWindow {
+    FVector Location;
+    FRotator ViewRotation;
+    float HalfHorizontalFieldOfView;
+    float HalfVerticalFieldOfView;
+
+    FGeneralUtilityConeWindow(const FVector &InLocation, const FRotator &InViewRotation,
+                              float HorizontalFieldOfView, float VerticalFieldOfView)
+            : Location(InLocation), ViewRotation(InViewRotation),
+              HalfHorizontalFieldOfView(HorizontalFieldOfView / 2.f),
+              HalfVerticalFieldOfView(VerticalFieldOfView / 2.f) {}
+
+    /**
+     * @param Point     World location to test
+     * @return          The yaw and pitch of the point relative to the view direction, each in the range [-180, 180]
+     */
+    FORCEINLINE FRotator GetRelativeAngles(const FVector &Point) const {
+        const FRotator angle = (Point - Location).Rotation();
+        return FRotator(FMath::FindDeltaAngleDegrees(ViewRotation.Pitch, angle.Pitch),
+                        FMath::FindDeltaAngleDegrees(ViewRotation.Yaw, angle.Yaw), 0.f);
+    }
+
+    /**
+     * @return          True if the field of view covers every direction (360 by 180), whatever the view's pitch
+     */
+    FORCEINLINE bool IsFullSphere() const {
+        return HalfHorizontalFieldOfView >= 180.f && HalfVerticalFieldOfView >= 90.f;
+    }
+
+    /**
+     * @param Point     World location to test
+     * @return          True if the direction towards the point lies within the cone's field of view
+     */
+    FORCEINLINE bool Contains(const FVector &Point) const {
+        if (IsFullSphere()) {
+            return true;
+        }
+
+        const FRotator relative = GetRelativeAngles(Point);
+        return FMath::Abs(relative.Yaw) <= HalfHorizontalFieldOfView
+               && FMath::Abs(relative.Pitch) <= HalfVerticalFieldOfView;
+    }
+
+    /**
+     * Finds an oriented box enclosing the part of the cone between two distances, by bounding a grid of directions over
+     * the cone's angular window and padding the result by the largest angular gap between them
+     *
+     * @param NearDistance      Distance from the location the slice starts at
+     * @param FarDistance       Distance from the location the slice ends at
+     * @param OutCenter         World center of the box
+     * @param OutHalfSize       Half extents of the box
+     * @param OutOrientation    Rotation of the box
+     * @return                  False if a sphere of the far distance would be the tighter volume
+     */
+    bool GetSliceBox(float NearDistance, float FarDistance,
+                     FVector &OutCenter, FVector &OutHalfSize, FRotator &OutOrientation) const {
+        constexpr int32 samples = 9;
+
+        const FRotator orientation(FRotator::NormalizeAxis(ViewRotation.Pitch), ViewRotation.Yaw, 0.f);
+        float yawStep = HalfHorizontalFieldOfView * 2.f / (samples - 1);
+        float pitchStep = HalfVerticalFieldOfView * 2.f / (samples - 1);
+
+        FVector min(MAX_flt);
+        FVector max(-MAX_flt);
+
+        for (int32 i = 0; i < samples; i++) {
+            for (int32 j = 0; j < samples; j++) {
+                FRotator direction(FMath::Clamp(orientation.Pitch - HalfVerticalFieldOfView + j * pitchStep,
+                                                -90.f, 90.f),
+                                   orientation.Yaw - HalfHorizontalFieldOfView + i * yawStep, 0.f);
+                FVector local = orientation.UnrotateVector(direction.Vector());
+
+                min = min.ComponentMin(local * NearDistance).ComponentMin(local * FarDistance);
+                max = max.ComponentMax(local * NearDistance).ComponentMax(local * FarDistance);
+            }
+        }
+
+        float padding = FarDistance * FMath::DegreesToRadians(
+                FMath::Sqrt(FMath::Square(yawStep) + FMath::Square(pitchStep)) / 2.f);
+        min = (min - FVector(padding)).ComponentMax(FVector(-FarDistance));
+        max = (max + FVector(padding)).ComponentMin(FVector(FarDistance));
+
+        FVector halfSize = (max - min) / 2.f;
+        if (8.f * halfSize.X * halfSize.Y * halfSize.Z >= 4.f / 3.f * PI * FMath::Cube(FarDistance)) {
+            return false;
+        }
+
+        OutCenter = Location + orientation.RotateVector((min + max) / 2.f);
+        OutHalfSize = halfSize;
+        OutOrientation = orientation;
+        return true;
+    }
+};
+
+/**
+ * Trig free form of {@link FGeneralUtilityConeWindow::Contains} with a distance limit, the angles are turned into
+ * plane like tests once so many points can be checked against the same cone in a tight loop. A full sphere field of
+ * view only tests the distance, as centring its vertical window on a pitched view would clip it at the poles
+ */
+struct FGeneralUtilityConeTest {
+    FVector Location;
+    FVector2D Forward2D;
+    float CosHalfHorizontalFieldOfView;
+    float SinLowerPitch;
+    float CosLowerPitch;
+    float SinUpperPitch;
+    float CosUpperPitch;
+    float DistanceSquared;
+    bool bDistanceOnly;
+
+    FGeneralUtilityConeTest(const FGeneralUtilityConeWindow &Window, float Distance)
+            : Location(Window.Location), DistanceSquared(FMath::Square(Distance)),
+              bDistanceOnly(Window.IsFullSphere()) {
+        float yaw = FMath::DegreesToRadians(Window.ViewRotation.Yaw);
+        Forward2D = FVector2D(FMath::Cos(yaw), FMath::Sin(yaw));
+        CosHalfHorizontalFieldOfView = FMath::Cos(
+                FMath::DegreesToRadians(FMath::Min(Window.HalfHorizontalFieldOfView, 180.f)));
+
+        float pitch = FRotator::NormalizeAxis(Window.ViewRotation.Pitch);
+        float lowerPitch = FMath::DegreesToRadians(FMath::Max(pitch - Window.HalfVerticalFieldOfView, -90.f));
+        float upperPitch = FMath::DegreesToRadians(FMath::Min(pitch + Window.HalfVerticalFieldOfView, 90.f));
+        FMath::SinCos(&SinLowerPitch, &CosLowerPitch, lowerPitch);
+        FMath::SinCos(&SinUpperPitch, &CosUpperPitch, upperPitch);
+    }
+
+    /**
+     * @param Point     World location to test
+     * @return          True if the point is within the distance and its direction within the field of view
+     */
+    FORCEINLINE bool Contains(const FVector &Point) const {
+        const FVector offset = Point - Location;
+        if (offset.SizeSquared() > DistanceSquared) {
+            return false;
+        }
+        if (bDistanceOnly) {
+            return true;
+        }
+
+        float horizontal = offset.Size2D();
+        return offset.X * Forward2D.X + offset.Y * Forward2D.Y >= CosHalfHorizontalFieldOfView * horizontal
+               && offset.Z * CosLowerPitch - horizontal * SinLowerPitch >= 0.f
+               && horizontal * SinUpperPitch - offset.Z * CosUpperPitch >= 0.f;
+    }
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Components/SceneComponent.h>
+#include <Kismet/KismetSystemLibrary.h>
+#include "GeneralUtilityConeSweepComponent.generated.h"
+
+/**
+ * Radar like sensor for wide or full circle fields of view. Instead of querying the whole cone every update the field
+ * of view is split into yaw sectors and only the next few are queried each tick, rotating around the sensor, with
+ * each sector's result cached until it comes round again. The per tick cost stays the same however wide the sensor is
+ */
+UCLASS(ClassGroup = (GeneralUtility), meta = (BlueprintSpawnableComponent))
+class GENERALUTILITY_API UGeneralUtilityConeSweepComponent : public USceneComponent {
+    GENERATED_BODY()
+public:
+
+    /** This distance from the component that should be queried */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sweep", meta = (ClampMin = 0.0))
+    float Distance;
+
+    /** The horizontal angle that objects should be found within, centered on the component's forward direction */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sweep", meta = (ClampMin = 0.0, ClampMax = 360.0))
+    float HorizontalFieldOfView;
+
+    /** The vertical angle that objects should be found within */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sweep", meta = (ClampMin = 0.0, ClampMax = 180.0))
+    float VerticalFieldOfView;
+
+    /** How many slices the horizontal field of view is split into */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sweep", meta = (ClampMin = 1))
+    int32 SectorCount;
+
+    /** How many slices are queried each tick */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sweep", meta = (ClampMin = 1))
+    int32 SectorsPerUpdate;
+
+    /** Trace channel the slices are queried on, Visibility by default */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sweep")
+    TEnumAsByte<ETraceTypeQuery> TraceChannel;
+
+    /** True to test against complex collision, false to test against simplified collision */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sweep")
+    bool bTraceComplex;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sweep", AdvancedDisplay)
+    TEnumAsByte<EDrawDebugTrace::Type> DrawDebugType;
+
+    /** How long the debug renders should stay active */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sweep", AdvancedDisplay)
+    float DrawTime;
+
+    UGeneralUtilityConeSweepComponent();
+
+    virtual void TickComponent(float DeltaTime, enum ELevelTick TickType,
+                               FActorComponentTickFunction *ThisTickFunction) override;
+
+    /**
+     * Gathers the cached hits of all sectors, an actor found by more than one sector is only returned from the one
+     * updated most recently
+     *
+     * @param OutHits   The hits of the whole field of view
+     * @return          True if there was a hit, false otherwise.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Sweep")
+    bool GetHits(TArray<FHitResult> &OutHits) const;
+
+    /**
+     * Forgets the cached hits of all sectors, starting the sweep over
+     */
+    UFUNCTION(BlueprintCallable, Category = "Sweep")
+    void ResetSweep();
+
+protected:
+
+    /**
+     * Queries a single sector, replacing its cached hits
+     */
+    void UpdateSector(int32 SectorIndex);
+
+    /** Cached hits of each sector */
+    TArray<TArray<FHitResult> > Sectors;
+
+    /** The sector the next tick starts from */
+    int32 NextSector;
+};
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <Engine/DataAsset.h>
+#include "GeneralUtilityTypes.h"
+#include "GeneralUtilityStaticTargetIndex.generated.h"
+
+/**
+ * A baked target, plain data so the whole array is serialized in one block
+ */
+struct FGeneralUtilityStaticTarget {
+    FVector Location;
+    int32 TagIndex;
+
+    friend FArchive &operator<<(FArchive &Ar, FGeneralUtilityStaticTarget &Target) {
+        return Ar << Target.Location << Target.TagIndex;
+    }
+};
+
+/**
+ * A node of the flattened bounding volume hierarchy over the targets. Leaf nodes reference a run of targets, the
+ * other nodes a run of child nodes
+ */
+struct FGeneralUtilityStaticTargetNode {
+    FVector Min;
+    FVector Max;
+    int32 First;
+    int32 Count;
+
+    friend FArchive &operator<<(FArchive &Ar, FGeneralUtilityStaticTargetNode &Node) {
+        return Ar << Node.Min << Node.Max << Node.First << Node.Count;
+    }
+};
+
+/**
+ * Spatial index of the static cone query targets of a level (interactables, spawn points, cover markers...), baked in
+ * the editor so they don't have to be found by sweeping the physics scene at runtime. Targets are stored Morton ordered
+ * with a flattened hierarchy of bounds on top, both loaded as single blocks without any per target allocation
+ */
+UCLASS(BlueprintType)
+class GENERALUTILITY_API UGeneralUtilityStaticTargetIndex : public UDataAsset {
+    GENERATED_BODY()
+public:
+
+#if WITH_EDITORONLY_DATA
+    /** Static actors with this tag are baked */
+    UPROPERTY(EditAnywhere, Category = "Baking")
+    FName TargetTag;
+
+    /** Static actors of these classes are baked */
+    UPROPERTY(EditAnywhere, Category = "Baking")
+    TArray<TSubclassOf<AActor> > TargetClasses;
+
+    /** How many targets each leaf of the hierarchy holds */
+    UPROPERTY(EditAnywhere, Category = "Baking", meta = (ClampMin = 1))
+    int32 LeafSize = 32;
+#endif
+
+    /** Tags of the baked targets, referenced by index */
+    UPROPERTY(VisibleAnywhere, Category = "Static Targets")
+    TArray<FName> Tags;
+
+#if WITH_EDITOR
+
+    /**
+     * Replaces the index with the matching static actors of a world
+     *
+     * @param WorldContextObject    World context
+     */
+    UFUNCTION(BlueprintCallable, Category = "Baking", meta = (WorldContext = "WorldContextObject"))
+    void BakeFromWorld(UObject *WorldContextObject);
+
+    /**
+     * Replaces the index with the matching static actors of the level open in the editor
+     */
+    UFUNCTION(CallInEditor, Category = "Baking")
+    void BakeFromEditorWorld();
+
+#endif
+
+    /**
+     * Appends the targets that lie within the cone to the supplied array
+     *
+     * @param Location                  Start location (e.g. camera)
+     * @param ViewRotation              Which angle the cone forms (e.g. camera's forward rotation)
+     * @param Distance                  This distance from the {@code Location} that should be queried
+     * @param HorizontalFieldOfView     The horizontal angle that targets should be found within
+     * @param VerticalFieldOfView       The vertical angle that targets should be found within
+     * @param OutHits                   The list to add the found targets to
+     * @return                          How many targets were added
+     */
+    int32 QueryCone(const FVector &Location, const FRotator &ViewRotation, float Distance,
+                    float HorizontalFieldOfView, float VerticalFieldOfView,
+                    TArray<FGeneralUtilityStaticTargetHit> &OutHits) const;
+
+    /**
+     * @return  How many targets are in the index
+     */
+    int32 Num() const {
+        return Targets.Num();
+    }
+
+    virtual void Serialize(FArchive &Ar) override;
+
+protected:
+
+    /** Morton ordered targets */
+    TArray<FGeneralUtilityStaticTarget> Targets;
+
+    /** The hierarchy, leaves first and the root last */
+    TArray<FGeneralUtilityStaticTargetNode> Nodes;
+
+    /** How many of the first nodes are leaves */
+    int32 LeafCount = 0;
+};
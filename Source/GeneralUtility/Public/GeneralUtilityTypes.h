@@ -0,0 +1,249 @@
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Engine/EngineTypes.h>
+#include "GeneralUtilityConeMath.h"
+#include "GeneralUtilityTypes.generated.h"
+
+/**
+ * A single yaw/pitch bin of a {@link FGeneralUtilityConeOccupancyGrid}
+ */
+USTRUCT(BlueprintType)
+struct GENERALUTILITY_API FGeneralUtilityConeOccupancyBin {
+    GENERATED_BODY()
+
+    /** How many actors were found in the direction this bin covers */
+    UPROPERTY(BlueprintReadOnly, Category = "Occupancy")
+    int32 Count = 0;
+
+    /** Distance to the nearest actor in this bin, only meaningful when Count is above 0 */
+    UPROPERTY(BlueprintReadOnly, Category = "Occupancy")
+    float NearestDistance = 0.f;
+
+    /** Bit N is set when an actor in this bin is of the N'th class in the query's class filter */
+    UPROPERTY(BlueprintReadOnly, Category = "Occupancy")
+    int32 ClassMask = 0;
+};
+
+/**
+ * Fixed resolution yaw x pitch grid covering a cone, filled by the Cone*Occupancy* queries.
+ * The bins are stored in a single flat array, pitch major starting from the lowest pitch and yaw, so any direction can
+ * be read back in constant time with {@link GetBinIndex}
+ */
+USTRUCT(BlueprintType)
+struct GENERALUTILITY_API FGeneralUtilityConeOccupancyGrid {
+    GENERATED_BODY()
+
+    /** Upper limit of the bins along each axis, keeping the grid's size bounded whatever a query asks for */
+    static constexpr int32 MaxBinsPerAxis = 256;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Occupancy")
+    FVector Location = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Occupancy")
+    FRotator ViewRotation = FRotator::ZeroRotator;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Occupancy")
+    float HorizontalFieldOfView = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Occupancy")
+    float VerticalFieldOfView = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Occupancy")
+    int32 YawBins = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Occupancy")
+    int32 PitchBins = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Occupancy")
+    TArray<FGeneralUtilityConeOccupancyBin> Bins;
+
+    /**
+     * Sets up the grid for a new query, reusing the existing allocation where possible. The bin counts are clamped to
+     * [1, {@link MaxBinsPerAxis}]
+     */
+    void Reset(const FVector &InLocation, const FRotator &InViewRotation, float InHorizontalFieldOfView,
+               float InVerticalFieldOfView, int32 InYawBins, int32 InPitchBins) {
+        Location = InLocation;
+        ViewRotation = InViewRotation;
+        HorizontalFieldOfView = InHorizontalFieldOfView;
+        VerticalFieldOfView = InVerticalFieldOfView;
+        YawBins = FMath::Clamp(InYawBins, 1, MaxBinsPerAxis);
+        PitchBins = FMath::Clamp(InPitchBins, 1, MaxBinsPerAxis);
+
+        Bins.Reset(YawBins * PitchBins);
+        Bins.AddDefaulted(YawBins * PitchBins);
+    }
+
+    /**
+     * @param Point     World location to look up
+     * @return          Index into {@link Bins} covering the direction towards the point, INDEX_NONE if outside the cone
+     */
+    int32 GetBinIndex(const FVector &Point) const {
+        if (Bins.Num() == 0) {
+            return INDEX_NONE;
+        }
+
+        const FGeneralUtilityConeWindow window(Location, ViewRotation, HorizontalFieldOfView, VerticalFieldOfView);
+        const FRotator relative = window.GetRelativeAngles(Point);
+
+        float yaw = (relative.Yaw + window.HalfHorizontalFieldOfView)
+                    / FMath::Max(HorizontalFieldOfView, KINDA_SMALL_NUMBER);
+        float pitch = (relative.Pitch + window.HalfVerticalFieldOfView)
+                      / FMath::Max(VerticalFieldOfView, KINDA_SMALL_NUMBER);
+
+        if (yaw < 0.f || yaw > 1.f || pitch < 0.f || pitch > 1.f) {
+            return INDEX_NONE;
+        }
+
+        int32 column = FMath::Min(FMath::FloorToInt(yaw * YawBins), YawBins - 1);
+        int32 row = FMath::Min(FMath::FloorToInt(pitch * PitchBins), PitchBins - 1);
+        return row * YawBins + column;
+    }
+};
+
+/**
+ * A target found in a {@link UGeneralUtilityStaticTargetIndex} by a cone query
+ */
+USTRUCT(BlueprintType)
+struct GENERALUTILITY_API FGeneralUtilityStaticTargetHit {
+    GENERATED_BODY()
+
+    /** Index of the target within the baked index */
+    UPROPERTY(BlueprintReadOnly, Category = "Static Targets")
+    int32 Index = INDEX_NONE;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Static Targets")
+    FVector Location = FVector::ZeroVector;
+
+    /** The first tag of the actor the target was baked from */
+    UPROPERTY(BlueprintReadOnly, Category = "Static Targets")
+    FName Tag;
+
+    /** Distance from the query's location */
+    UPROPERTY(BlueprintReadOnly, Category = "Static Targets")
+    float Distance = 0.f;
+};
+
+/**
+ * How the targets of a {@link FGeneralUtilityConeBand} are found
+ */
+UENUM(BlueprintType)
+enum class EGeneralUtilityConeBandQuery : uint8 {
+    /** Traced against complex collision */
+    Complex,
+    /** Traced against simplified collision */
+    Simple,
+    /** Only the baked static targets are queried, the physics scene is not touched */
+    StaticTargets
+};
+
+/**
+ * A distance band of a banded cone query, it starts where the previous band ended
+ */
+USTRUCT(BlueprintType)
+struct GENERALUTILITY_API FGeneralUtilityConeBand {
+    GENERATED_BODY()
+
+    /** Distance from the cone's location at which this band ends */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Band", meta = (ClampMin = 0.0))
+    float MaxDistance = 1000.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Band")
+    EGeneralUtilityConeBandQuery Query = EGeneralUtilityConeBandQuery::Simple;
+};
+
+/**
+ * Shape of an agent's view, as used by {@link UGeneralUtilityBPLibrary::ComputeMutualVisibility}
+ */
+USTRUCT(BlueprintType)
+struct GENERALUTILITY_API FGeneralUtilityViewCone {
+    GENERATED_BODY()
+
+    /** How far the agent can see */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "View", meta = (ClampMin = 0.0))
+    float Distance = 3000.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "View", meta = (ClampMin = 0.0, ClampMax = 360.0))
+    float HorizontalFieldOfView = 90.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "View", meta = (ClampMin = 0.0, ClampMax = 180.0))
+    float VerticalFieldOfView = 60.f;
+};
+
+/**
+ * Packed "who can see whom" matrix of N agents, bit (Viewer * AgentCount + Target) is set when the viewer can see the
+ * target
+ */
+USTRUCT(BlueprintType)
+struct GENERALUTILITY_API FGeneralUtilityVisibilityMatrix {
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Visibility")
+    int32 AgentCount = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Visibility")
+    TArray<int32> Bits;
+
+    /**
+     * Clears the matrix for a new set of agents, reusing the existing allocation where possible
+     */
+    void Reset(int32 InAgentCount) {
+        AgentCount = InAgentCount;
+        Bits.Reset();
+        Bits.AddZeroed((AgentCount * AgentCount + 31) / 32);
+    }
+
+    void Set(int32 Viewer, int32 Target) {
+        int32 bit = Viewer * AgentCount + Target;
+        Bits[bit >> 5] |= static_cast<int32>(1u << (bit & 31));
+    }
+
+    bool Get(int32 Viewer, int32 Target) const {
+        if (Viewer < 0 || Target < 0 || Viewer >= AgentCount || Target >= AgentCount) {
+            return false;
+        }
+
+        int32 bit = Viewer * AgentCount + Target;
+        return (Bits[bit >> 5] & static_cast<int32>(1u << (bit & 31))) != 0;
+    }
+};
+
+/**
+ * A region of a {@link UGeneralUtilityVisionProfile}, a field of view of 360 by 180 makes it a sphere
+ */
+USTRUCT(BlueprintType)
+struct GENERALUTILITY_API FGeneralUtilityVisionRegion {
+    GENERATED_BODY()
+
+    /** Reported with every hit classified into this region */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Region")
+    FName Tag;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Region", meta = (ClampMin = 0.0))
+    float Distance = 3000.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Region", meta = (ClampMin = 0.0, ClampMax = 360.0))
+    float HorizontalFieldOfView = 90.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Region", meta = (ClampMin = 0.0, ClampMax = 180.0))
+    float VerticalFieldOfView = 60.f;
+};
+
+/**
+ * An actor found by a vision profile query, along with the region it was classified into
+ */
+USTRUCT(BlueprintType)
+struct GENERALUTILITY_API FGeneralUtilityVisionHit {
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Vision")
+    FHitResult Hit;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Vision")
+    FName RegionTag;
+
+    /** Index of the region within the profile */
+    UPROPERTY(BlueprintReadOnly, Category = "Vision")
+    int32 RegionIndex = INDEX_NONE;
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <Engine/DataAsset.h>
+#include "GeneralUtilityTypes.h"
+#include "GeneralUtilityVisionProfile.generated.h"
+
+/**
+ * Vision made of several regions, e.g. a narrow focal cone, a wide peripheral cone and a short proximity sphere, all
+ * evaluated together by the ConeVisionProfile* queries
+ */
+UCLASS(BlueprintType)
+class GENERALUTILITY_API UGeneralUtilityVisionProfile : public UDataAsset {
+    GENERATED_BODY()
+public:
+
+    /** The regions in order of priority, an actor within several regions is classified into the first of them */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Vision")
+    TArray<FGeneralUtilityVisionRegion> Regions;
+
+    /**
+     * @return      The furthest distance any of the regions reaches
+     */
+    UFUNCTION(BlueprintPure, Category = "Vision")
+    float GetMaxDistance() const;
+};